@@ -0,0 +1,285 @@
+#include <algorithm>
+
+#include <benchmark/benchmark.h>
+
+#include "random.h"
+
+static const std::size_t COUNT = 1024;
+
+static void add(benchmark::State & state){
+    const std::vector <uint256_t> lhs = random_values(COUNT);
+    const std::vector <uint256_t> rhs = random_values(COUNT, 256, 0xad);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(lhs[i] + rhs[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(add);
+
+static void subtract(benchmark::State & state){
+    const std::vector <uint256_t> lhs = random_values(COUNT);
+    const std::vector <uint256_t> rhs = random_values(COUNT, 256, 0xad);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(lhs[i] - rhs[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(subtract);
+
+// 64 bit right hand sides
+static void add_u64(benchmark::State & state){
+    const std::vector <uint256_t> lhs = random_values(COUNT);
+    const std::vector <uint256_t> rhs = random_values(COUNT, 64, 0xad);
+    std::vector <uint64_t> small(COUNT);
+    for(std::size_t i = 0; i < COUNT; i++){
+        small[i] = (uint64_t) rhs[i];
+    }
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(lhs[i] + small[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(add_u64);
+
+static void subtract_u64(benchmark::State & state){
+    const std::vector <uint256_t> lhs = random_values(COUNT);
+    const std::vector <uint256_t> rhs = random_values(COUNT, 64, 0xad);
+    std::vector <uint64_t> small(COUNT);
+    for(std::size_t i = 0; i < COUNT; i++){
+        small[i] = (uint64_t) rhs[i];
+    }
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(lhs[i] - small[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(subtract_u64);
+
+// running sum; every addition depends on the previous one
+static void add_checked(benchmark::State & state){
+    const std::vector <uint256_t> lhs = random_values(COUNT);
+    const std::vector <uint256_t> rhs = random_values(COUNT, 256, 0xad);
+    uint256_t sum;
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(add_overflow(lhs[i], rhs[i], sum));
+            benchmark::DoNotOptimize(sum);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(add_checked);
+
+static void accumulate(benchmark::State & state){
+    const std::vector <uint256_t> values = random_values(COUNT);
+    for(auto _ : state){
+        uint256_t sum = 0;
+        for(const uint256_t & value : values){
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(accumulate);
+
+static void increment(benchmark::State & state){
+    uint256_t value(0, 0, 0, (uint64_t) -COUNT);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(++value);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(increment);
+
+static void multiply(benchmark::State & state){
+    const std::vector <uint256_t> lhs = random_values(COUNT);
+    const std::vector <uint256_t> rhs = random_values(COUNT, 256, 0xad);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(lhs[i] * rhs[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(multiply);
+
+static void multiply_u64(benchmark::State & state){
+    const std::vector <uint256_t> lhs = random_values(COUNT);
+    const std::vector <uint256_t> rhs = random_values(COUNT, 64, 0xad);
+    std::vector <uint64_t> small(COUNT);
+    for(std::size_t i = 0; i < COUNT; i++){
+        small[i] = (uint64_t) rhs[i];
+    }
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(lhs[i] * small[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(multiply_u64);
+
+// operand width in bits; 128 bit operands never overflow
+static void multiply_checked(benchmark::State & state){
+    const std::vector <uint256_t> lhs = random_values(COUNT, state.range(0));
+    const std::vector <uint256_t> rhs = random_values(COUNT, state.range(0), 0xad);
+    uint256_t product;
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(mul_overflow(lhs[i], rhs[i], product));
+            benchmark::DoNotOptimize(product);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(multiply_checked)->Arg(128)->Arg(256);
+
+static void multiply_wide(benchmark::State & state){
+    const std::vector <uint256_t> lhs = random_values(COUNT);
+    const std::vector <uint256_t> rhs = random_values(COUNT, 256, 0xad);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(mul_wide(lhs[i], rhs[i]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(multiply_wide);
+
+static void multiply_high(benchmark::State & state){
+    const std::vector <uint256_t> lhs = random_values(COUNT);
+    const std::vector <uint256_t> rhs = random_values(COUNT, 256, 0xad);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(mulhi(lhs[i], rhs[i]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(multiply_high);
+
+static void negate(benchmark::State & state){
+    const std::vector <uint256_t> values = random_values(COUNT);
+    for(auto _ : state){
+        for(const uint256_t & value : values){
+            benchmark::DoNotOptimize(-value);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(negate);
+
+// operand width in bits; narrower operands share more upper limbs
+static void less_than(benchmark::State & state){
+    const std::vector <uint256_t> lhs = random_values(COUNT, state.range(0));
+    const std::vector <uint256_t> rhs = random_values(COUNT, state.range(0), 0xad);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(lhs[i] < rhs[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(less_than)->Arg(64)->Arg(256);
+
+static void less_equal(benchmark::State & state){
+    const std::vector <uint256_t> lhs = random_values(COUNT, state.range(0));
+    const std::vector <uint256_t> rhs = random_values(COUNT, state.range(0), 0xad);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(lhs[i] <= rhs[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(less_equal)->Arg(64)->Arg(256);
+
+static void sort(benchmark::State & state){
+    const std::vector <uint256_t> values = random_values(COUNT, state.range(0));
+    for(auto _ : state){
+        std::vector <uint256_t> sorted(values);
+        std::sort(sorted.begin(), sorted.end());
+        benchmark::DoNotOptimize(sorted.data());
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(sort)->Arg(64)->Arg(256);
+
+static void equals(benchmark::State & state){
+    const std::vector <uint256_t> lhs = random_values(COUNT);
+    const std::vector <uint256_t> rhs(lhs);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(lhs[i] == rhs[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(equals);
+
+static void shift_left(benchmark::State & state){
+    const std::vector <uint256_t> values = random_values(COUNT);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(values[i] << (int) (i % 256));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(shift_left);
+
+static void shift_right(benchmark::State & state){
+    const std::vector <uint256_t> values = random_values(COUNT);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(values[i] >> (int) (i % 256));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(shift_right);
+
+// operand width in bits
+static void bits(benchmark::State & state){
+    const std::vector <uint256_t> values = random_values(COUNT, state.range(0));
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(values[i].bits());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(bits)->Arg(64)->Arg(256);
+
+static void popcount(benchmark::State & state){
+    const std::vector <uint256_t> values = random_values(COUNT);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(popcount(values[i]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(popcount);
+
+static void rotate_left(benchmark::State & state){
+    const std::vector <uint256_t> values = random_values(COUNT);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(rotl(values[i], (int) (i % 256)));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(rotate_left);
@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+
+#include "random.h"
+
+static const std::size_t COUNT = 1024;
+
+// modulus width in bits
+static void barrett_reduce(benchmark::State & state){
+    const std::vector <uint256_t> values = random_values(COUNT);
+    const barrett_context ctx(random_values(1, state.range(0), 0xba).front());
+    for(auto _ : state){
+        for(const uint256_t & value : values){
+            benchmark::DoNotOptimize(ctx.reduce(value));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(barrett_reduce)->Arg(64)->Arg(128)->Arg(192)->Arg(256);
+
+static void barrett_mulmod(benchmark::State & state){
+    const barrett_context ctx(random_values(1, state.range(0), 0xba).front());
+    std::vector <uint256_t> lhs = random_values(COUNT, 256, 0x5a);
+    std::vector <uint256_t> rhs = random_values(COUNT, 256, 0xad);
+    for(std::size_t i = 0; i < COUNT; i++){
+        lhs[i] = ctx.reduce(lhs[i]);
+        rhs[i] = ctx.reduce(rhs[i]);
+    }
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(ctx.mulmod(lhs[i], rhs[i]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(barrett_mulmod)->Arg(64)->Arg(128)->Arg(192)->Arg(256);
+
+// reference: reducing with operator%
+static void modulo_reduce(benchmark::State & state){
+    const std::vector <uint256_t> values = random_values(COUNT);
+    const uint256_t modulus = random_values(1, state.range(0), 0xba).front();
+    for(auto _ : state){
+        for(const uint256_t & value : values){
+            benchmark::DoNotOptimize(value % modulus);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(modulo_reduce)->Arg(64)->Arg(128)->Arg(192)->Arg(256);
+
+// operator% has no 512 bit form, so this only covers moduli up to 128 bits,
+// where the product of two reduced values still fits in 256 bits
+static void modulo_mulmod(benchmark::State & state){
+    const uint256_t modulus = random_values(1, state.range(0), 0xba).front();
+    std::vector <uint256_t> lhs = random_values(COUNT, 256, 0x5a);
+    std::vector <uint256_t> rhs = random_values(COUNT, 256, 0xad);
+    for(std::size_t i = 0; i < COUNT; i++){
+        lhs[i] %= modulus;
+        rhs[i] %= modulus;
+    }
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize((lhs[i] * rhs[i]) % modulus);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(modulo_mulmod)->Arg(64)->Arg(128);
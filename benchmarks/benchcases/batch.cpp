@@ -0,0 +1,102 @@
+#include <chrono>
+
+#include <benchmark/benchmark.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCHMARK_RDTSC
+#endif
+
+#include "random.h"
+
+static const std::size_t COUNT = 1024;
+
+static uint64_t ticks(){
+#if defined(BENCHMARK_RDTSC)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast <std::chrono::nanoseconds> (std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+// elements per tick of the time stamp counter, which counts cycles at the
+// base clock rather than the current one
+static void per_cycle(benchmark::State & state, const uint64_t elapsed){
+#if defined(BENCHMARK_RDTSC)
+    state.counters["per_cycle"] = (double) (state.iterations() * COUNT) / (double) elapsed;
+#else
+    (void) elapsed;
+#endif
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+
+template <void (*op)(const uint256_t *, const uint256_t *, uint256_t *, const std::size_t)>
+static void values(benchmark::State & state){
+    const std::vector <uint256_t> lhs = random_values(COUNT);
+    const std::vector <uint256_t> rhs = random_values(COUNT, 256, 0xad);
+    std::vector <uint256_t> out(COUNT);
+    const uint64_t start = ticks();
+    for(auto _ : state){
+        op(lhs.data(), rhs.data(), out.data(), COUNT);
+        benchmark::ClobberMemory();
+    }
+    per_cycle(state, ticks() - start);
+}
+BENCHMARK_TEMPLATE(values, add_n);
+BENCHMARK_TEMPLATE(values, sub_n);
+BENCHMARK_TEMPLATE(values, and_n);
+BENCHMARK_TEMPLATE(values, or_n);
+BENCHMARK_TEMPLATE(values, xor_n);
+
+template <void (*op)(const uint256_t *, const uint256_t *, uint64_t *, const std::size_t)>
+static void masks(benchmark::State & state){
+    const std::vector <uint256_t> lhs = random_values(COUNT);
+    // half of the values are equal, and the rest differ in their lowest limb
+    std::vector <uint256_t> rhs = lhs;
+    for(std::size_t i = 0; i < COUNT; i += 2){
+        rhs[i] ^= (uint64_t) i + 1;
+    }
+    std::vector <uint64_t> mask(COUNT);
+    const uint64_t start = ticks();
+    for(auto _ : state){
+        op(lhs.data(), rhs.data(), mask.data(), COUNT);
+        benchmark::ClobberMemory();
+    }
+    per_cycle(state, ticks() - start);
+}
+BENCHMARK_TEMPLATE(masks, lt_n);
+BENCHMARK_TEMPLATE(masks, eq_n);
+
+// the same work as add_n and lt_n with the operators, for comparison
+static void add_loop(benchmark::State & state){
+    const std::vector <uint256_t> lhs = random_values(COUNT);
+    const std::vector <uint256_t> rhs = random_values(COUNT, 256, 0xad);
+    std::vector <uint256_t> out(COUNT);
+    const uint64_t start = ticks();
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            out[i] = lhs[i] + rhs[i];
+        }
+        benchmark::ClobberMemory();
+    }
+    per_cycle(state, ticks() - start);
+}
+BENCHMARK(add_loop);
+
+static void less_loop(benchmark::State & state){
+    const std::vector <uint256_t> lhs = random_values(COUNT);
+    std::vector <uint256_t> rhs = lhs;
+    for(std::size_t i = 0; i < COUNT; i += 2){
+        rhs[i] ^= (uint64_t) i + 1;
+    }
+    std::vector <uint64_t> mask(COUNT);
+    const uint64_t start = ticks();
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            mask[i] = (uint64_t) 0 - (uint64_t) (lhs[i] < rhs[i]);
+        }
+        benchmark::ClobberMemory();
+    }
+    per_cycle(state, ticks() - start);
+}
+BENCHMARK(less_loop);
@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include "random.h"
+
+static const std::size_t COUNT = 1024;
+
+static void divide_u64(benchmark::State & state, const uint64_t divisor){
+    const std::vector <uint256_t> values = random_values(COUNT);
+    for(auto _ : state){
+        for(const uint256_t & value : values){
+            benchmark::DoNotOptimize(value / divisor);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK_CAPTURE(divide_u64, ten,      10ULL);
+BENCHMARK_CAPTURE(divide_u64, scale,    1000000000000000000ULL);
+BENCHMARK_CAPTURE(divide_u64, wide_u64, 0xfedcba9876543210ULL);
+
+static void modulo_u64(benchmark::State & state, const uint64_t divisor){
+    const std::vector <uint256_t> values = random_values(COUNT);
+    for(auto _ : state){
+        for(const uint256_t & value : values){
+            benchmark::DoNotOptimize(value % divisor);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK_CAPTURE(modulo_u64, shards, 97ULL);
+
+// divisor width in bits
+static void divide(benchmark::State & state){
+    const std::vector <uint256_t> values   = random_values(COUNT);
+    const std::vector <uint256_t> divisors = random_values(COUNT, state.range(0), 0xd1);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(values[i] / divisors[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(divide)->Arg(64)->Arg(128)->Arg(192)->Arg(256);
+
+static void modulo(benchmark::State & state){
+    const std::vector <uint256_t> values   = random_values(COUNT);
+    const std::vector <uint256_t> divisors = random_values(COUNT, state.range(0), 0xd1);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(values[i] % divisors[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(modulo)->Arg(64)->Arg(128)->Arg(192)->Arg(256);
+
+static void str(benchmark::State & state){
+    const std::vector <uint256_t> values = random_values(COUNT);
+    for(auto _ : state){
+        for(const uint256_t & value : values){
+            benchmark::DoNotOptimize(value.str(state.range(0)));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(str)->Arg(10)->Arg(16);
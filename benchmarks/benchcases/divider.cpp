@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+
+#include "random.h"
+
+static const std::size_t COUNT = 1024;
+
+// divisor width in bits
+static void divider_quotient(benchmark::State & state){
+    const std::vector <uint256_t> values = random_values(COUNT);
+    const uint256_divider divider(random_values(1, state.range(0), 0xd1).front());
+    for(auto _ : state){
+        for(const uint256_t & value : values){
+            benchmark::DoNotOptimize(value / divider);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(divider_quotient)->Arg(64)->Arg(128)->Arg(192)->Arg(256);
+
+static void divider_remainder(benchmark::State & state){
+    const std::vector <uint256_t> values = random_values(COUNT);
+    const uint256_divider divider(random_values(1, state.range(0), 0xd1).front());
+    for(auto _ : state){
+        for(const uint256_t & value : values){
+            benchmark::DoNotOptimize(value % divider);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(divider_remainder)->Arg(64)->Arg(128)->Arg(192)->Arg(256);
+
+static void divider_divides(benchmark::State & state){
+    const std::vector <uint256_t> values = random_values(COUNT);
+    const uint256_divider divider(random_values(1, state.range(0), 0xd1).front());
+    for(auto _ : state){
+        for(const uint256_t & value : values){
+            benchmark::DoNotOptimize(divider.divides(value));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(divider_divides)->Arg(64)->Arg(128)->Arg(192)->Arg(256);
+
+// the same divisions without a precomputed reciprocal
+static void divide_invariant(benchmark::State & state){
+    const std::vector <uint256_t> values = random_values(COUNT);
+    const uint256_t divisor = random_values(1, state.range(0), 0xd1).front();
+    for(auto _ : state){
+        for(const uint256_t & value : values){
+            benchmark::DoNotOptimize(value / divisor);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(divide_invariant)->Arg(64)->Arg(128)->Arg(192)->Arg(256);
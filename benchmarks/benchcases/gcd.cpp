@@ -0,0 +1,49 @@
+#include <benchmark/benchmark.h>
+
+#include "random.h"
+
+static const std::size_t COUNT = 16;
+
+// operand widths in bits
+static void gcd_binary(benchmark::State & state){
+    const std::vector <uint256_t> lhs = random_values(COUNT, state.range(0), 0x61);
+    const std::vector <uint256_t> rhs = random_values(COUNT, state.range(1), 0x9f);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(gcd(lhs[i], rhs[i]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(gcd_binary)->Args({64, 64})->Args({256, 64})->Args({128, 128})->Args({256, 128})->Args({256, 256});
+
+// reference: Euclid with operator%
+static void gcd_euclid(benchmark::State & state){
+    const std::vector <uint256_t> lhs = random_values(COUNT, state.range(0), 0x61);
+    const std::vector <uint256_t> rhs = random_values(COUNT, state.range(1), 0x9f);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            uint256_t a = lhs[i], b = rhs[i];
+            while (b){
+                const uint256_t r = a % b;
+                a = b;
+                b = r;
+            }
+            benchmark::DoNotOptimize(a);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(gcd_euclid)->Args({64, 64})->Args({256, 64})->Args({128, 128})->Args({256, 128})->Args({256, 256});
+
+static void lcm_binary(benchmark::State & state){
+    const std::vector <uint256_t> lhs = random_values(COUNT, 128, 0x61);
+    const std::vector <uint256_t> rhs = random_values(COUNT, 128, 0x9f);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(lcm(lhs[i], rhs[i]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(lcm_binary);
@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+
+#include "random.h"
+
+static const std::size_t COUNT = 16;
+
+static const uint256_t SECP256K1_P("fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f", 16);
+static const uint256_t P127("7fffffffffffffffffffffffffffffff", 16);
+
+static void invmod_256(benchmark::State & state){
+    std::vector <uint256_t> values = random_values(COUNT, 256, 0x3c);
+    for(uint256_t & value : values){
+        value %= SECP256K1_P;
+    }
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(invmod(values[i], SECP256K1_P));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(invmod_256);
+
+static void invmod_128(benchmark::State & state){
+    std::vector <uint256_t> values = random_values(COUNT, 256, 0x3c);
+    for(uint256_t & value : values){
+        value %= P127;
+    }
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(invmod(values[i], P127));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(invmod_128);
+
+// reference: Fermat's little theorem, value^(p - 2) mod p
+static void invmod_fermat_256(benchmark::State & state){
+    std::vector <uint256_t> values = random_values(COUNT, 256, 0x3c);
+    for(uint256_t & value : values){
+        value %= SECP256K1_P;
+    }
+    const uint256_t exp = SECP256K1_P - 2;
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(powmod(values[i], exp, SECP256K1_P));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(invmod_fermat_256);
+
+// reference: Fermat's little theorem with operator% after every step
+static void invmod_fermat_modulo_128(benchmark::State & state){
+    std::vector <uint256_t> values = random_values(COUNT, 256, 0x3c);
+    for(uint256_t & value : values){
+        value %= P127;
+    }
+    const uint256_t exp = P127 - 2;
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            uint256_t result = 1;
+            for(int bit = exp.bits() - 1; bit >= 0; bit--){
+                result = (result * result) % P127;
+                if ((exp >> bit) & 1){
+                    result = (result * values[i]) % P127;
+                }
+            }
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(invmod_fermat_modulo_128);
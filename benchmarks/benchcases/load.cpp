@@ -0,0 +1,45 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "random.h"
+
+static const std::size_t COUNT = 1 << 18;
+static const std::string path = "uint256_t_load_bench.txt";
+
+static void write_file(){
+    std::ofstream file(path.c_str());
+    for(const uint256_t & value : random_values(COUNT)){
+        file << value.str(10) << '\n';
+    }
+}
+
+// number of threads; 0 for one per core
+static void load(benchmark::State & state){
+    write_file();
+    for(auto _ : state){
+        benchmark::DoNotOptimize(load_uint256_file(path, 10, state.range(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+    std::remove(path.c_str());
+}
+BENCHMARK(load)->Arg(1)->Arg(0)->Unit(benchmark::kMillisecond);
+
+// reading one line at a time
+static void load_getline(benchmark::State & state){
+    write_file();
+    for(auto _ : state){
+        std::ifstream file(path.c_str());
+        std::vector <uint256_t> values;
+        std::string line;
+        while (std::getline(file, line)){
+            values.push_back(uint256_t(line, 10));
+        }
+        benchmark::DoNotOptimize(values);
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+    std::remove(path.c_str());
+}
+BENCHMARK(load_getline)->Unit(benchmark::kMillisecond);
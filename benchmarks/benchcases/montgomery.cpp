@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+
+#include "random.h"
+
+static const std::size_t COUNT = 1024;
+
+typedef montgomery_field <secp256k1_p> field;
+
+static std::vector <field> random_elements(const std::size_t count, const uint64_t seed){
+    const std::vector <uint256_t> values = random_values(count, 256, seed);
+    return std::vector <field>(values.begin(), values.end());
+}
+
+static void montgomery_multiply(benchmark::State & state){
+    const std::vector <field> lhs = random_elements(COUNT, 0x5a);
+    const std::vector <field> rhs = random_elements(COUNT, 0xad);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(lhs[i] * rhs[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(montgomery_multiply);
+
+static void montgomery_square(benchmark::State & state){
+    const std::vector <field> values = random_elements(COUNT, 0x5a);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(values[i].square());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(montgomery_square);
+
+static void montgomery_add(benchmark::State & state){
+    const std::vector <field> lhs = random_elements(COUNT, 0x5a);
+    const std::vector <field> rhs = random_elements(COUNT, 0xad);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(lhs[i] + rhs[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(montgomery_add);
+
+// reference: reducing with operator%
+// the truncated product skips the top half, so this undercounts a real mulmod
+static void modulo_multiply(benchmark::State & state){
+    const uint256_t p = field::modulus();
+    const std::vector <uint256_t> lhs = random_values(COUNT, 256, 0x5a);
+    const std::vector <uint256_t> rhs = random_values(COUNT, 256, 0xad);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize((lhs[i] * rhs[i]) % p);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(modulo_multiply);
+
+static void modulo_add(benchmark::State & state){
+    const uint256_t p = field::modulus();
+    const std::vector <uint256_t> lhs = random_values(COUNT, 256, 0x5a);
+    const std::vector <uint256_t> rhs = random_values(COUNT, 256, 0xad);
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize((lhs[i] % p + rhs[i] % p) % p);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(modulo_add);
@@ -0,0 +1,24 @@
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "random.h"
+
+static const std::size_t COUNT = 1024;
+
+// base of the strings
+static void parse(benchmark::State & state){
+    const uint8_t base = state.range(0);
+    std::vector <std::string> strings;
+    for(const uint256_t & value : random_values(COUNT)){
+        strings.push_back(value.str(base));
+    }
+
+    for(auto _ : state){
+        for(const std::string & s : strings){
+            benchmark::DoNotOptimize(uint256_t(s, base));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(parse)->Arg(10)->Arg(16);
@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+
+#include "random.h"
+
+static const std::size_t COUNT = 16;
+
+// modulus width in bits; the exponents are as wide as the modulus
+static void powmod_odd(benchmark::State & state){
+    const std::vector <uint256_t> bases = random_values(COUNT, 256, 0x5a);
+    const std::vector <uint256_t> exps = random_values(COUNT, state.range(0), 0xe7);
+    const uint256_t mod = random_values(1, state.range(0), 0x0d).front() | 1;
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(powmod(bases[i], exps[i], mod));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(powmod_odd)->Arg(64)->Arg(128)->Arg(256);
+
+static void powmod_even(benchmark::State & state){
+    const std::vector <uint256_t> bases = random_values(COUNT, 256, 0x5a);
+    const std::vector <uint256_t> exps = random_values(COUNT, state.range(0), 0xe7);
+    const uint256_t mod = random_values(1, state.range(0), 0x0d).front() & ~uint256_1;
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            benchmark::DoNotOptimize(powmod(bases[i], exps[i], mod));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(powmod_even)->Arg(64)->Arg(128)->Arg(256);
+
+// reference: square and multiply with operator% after every step
+// the products of reduced values only fit for moduli up to 128 bits
+static void powmod_modulo(benchmark::State & state){
+    const std::vector <uint256_t> bases = random_values(COUNT, 256, 0x5a);
+    const std::vector <uint256_t> exps = random_values(COUNT, state.range(0), 0xe7);
+    const uint256_t mod = random_values(1, state.range(0), 0x0d).front() | 1;
+    for(auto _ : state){
+        for(std::size_t i = 0; i < COUNT; i++){
+            const uint256_t base = bases[i] % mod;
+            uint256_t result = 1;
+            for(int bit = exps[i].bits() - 1; bit >= 0; bit--){
+                result = (result * result) % mod;
+                if ((exps[i] >> bit) & 1){
+                    result = (result * base) % mod;
+                }
+            }
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(powmod_modulo)->Arg(64)->Arg(128);
@@ -0,0 +1,11 @@
+#!/usr/bin/env bash
+
+# same as tests/install_gtest.sh, but for google benchmark
+cd ..
+git clone https://github.com/google/benchmark.git
+cd benchmark
+mkdir build
+cd build
+cmake .. -DCMAKE_BUILD_TYPE=Release -DBENCHMARK_ENABLE_TESTING=OFF -DCMAKE_INSTALL_PREFIX=install
+make -j $(nproc --all)
+make -j install
@@ -0,0 +1,22 @@
+#ifndef __UINT256_T_BENCHMARK_RANDOM__
+#define __UINT256_T_BENCHMARK_RANDOM__
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "uint256_t.h"
+
+// fixed seeds so that runs can be compared against each other
+inline std::vector <uint256_t> random_values(const std::size_t count, const uint16_t bits = 256, const uint64_t seed = 0x5eed){
+    std::mt19937_64 gen(seed);
+    std::vector <uint256_t> out;
+    out.reserve(count);
+    for(std::size_t i = 0; i < count; i++){
+        const uint256_t value(gen(), gen(), gen(), gen());
+        out.push_back((bits < 256)?(value >> (256 - bits)):value);
+    }
+    return out;
+}
+
+#endif
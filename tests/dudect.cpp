@@ -0,0 +1,158 @@
+// Timing variance test for the constant time functions
+//
+// Follows Reparaz, Balasch and Verbauwhede, "Dude, is my code constant
+// time?" (2017): each function is timed on two classes of inputs, one fixed
+// and one random, picked at random for every measurement. Welch's t-test
+// then compares the two sets of timings. Timings above a few percentiles
+// are also cropped and tested, since interrupts only ever add time.
+//
+// usage: ./dudect [measurements per function]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define DUDECT_RDTSC
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define DUDECT_RDTSC
+#endif
+
+#include "uint256_t.h"
+
+// |t| above this means the two classes are timed differently
+static const double THRESHOLD = 10;
+
+static volatile uint64_t sink;
+
+static uint64_t ticks(){
+#if defined(DUDECT_RDTSC)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast <std::chrono::nanoseconds> (std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+// Welch's t statistic between the timings of class 0 and class 1
+static double welch_t(const std::vector <uint64_t> & times, const std::vector <uint8_t> & classes, const uint64_t cutoff){
+    double n[2] = {0, 0}, mean[2] = {0, 0}, m2[2] = {0, 0};
+    for(std::size_t i = 0; i < times.size(); i++){
+        if (times[i] > cutoff){
+            continue;
+        }
+        const int c = classes[i];
+        const double x = (double) times[i];
+        n[c]++;
+        const double delta = x - mean[c];
+        mean[c] += delta / n[c];
+        m2[c] += delta * (x - mean[c]);
+    }
+    if ((n[0] < 2) || (n[1] < 2)){
+        return 0;
+    }
+    const double var = m2[0] / (n[0] - 1) / n[0] + m2[1] / (n[1] - 1) / n[1];
+    return (var > 0)?((mean[0] - mean[1]) / std::sqrt(var)):0;
+}
+
+// largest |t| over the uncropped timings and a few percentile crops
+static double max_t(const std::vector <uint64_t> & times, const std::vector <uint8_t> & classes){
+    std::vector <uint64_t> sorted = times;
+    std::sort(sorted.begin(), sorted.end());
+    double worst = std::fabs(welch_t(times, classes, sorted.back()));
+    for(const double percentile : {0.5, 0.75, 0.9, 0.95, 0.99}){
+        const uint64_t cutoff = sorted[(std::size_t) (percentile * (sorted.size() - 1))];
+        worst = std::max(worst, std::fabs(welch_t(times, classes, cutoff)));
+    }
+    return worst;
+}
+
+struct inputs{
+    uint256_t a, b;
+    uint64_t x;
+};
+
+// Op is called with the inputs of each measurement and returns something to keep
+template <typename Op>
+static double measure(const std::size_t count, const inputs & fixed, std::mt19937_64 & rng, Op op){
+    std::uniform_int_distribution <uint64_t> dist;
+    std::vector <inputs> in(count);
+    std::vector <uint8_t> classes(count);
+    for(std::size_t i = 0; i < count; i++){
+        classes[i] = dist(rng) & 1;
+        if (classes[i]){
+            in[i].a = uint256_t(dist(rng), dist(rng), dist(rng), dist(rng));
+            in[i].b = uint256_t(dist(rng), dist(rng), dist(rng), dist(rng));
+            in[i].x = dist(rng);
+        }
+        else{
+            in[i] = fixed;
+        }
+    }
+
+    std::vector <uint64_t> times(count);
+    for(std::size_t i = 0; i < count; i++){
+        const uint64_t start = ticks();
+        sink = op(in[i]);
+        times[i] = ticks() - start;
+    }
+    return max_t(times, classes);
+}
+
+int main(int argc, char * argv[]){
+    const std::size_t count = (argc > 1)?std::strtoul(argv[1], nullptr, 10):200000;
+    const uint256_t p("fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f", 16);
+    const uint256_t value("6a09e667f3bcc908bb67ae8584caa73b3c6ef372fe94f82ba54ff53a5f1d36f1", 16);
+    std::mt19937_64 rng(0x5eed);
+
+    struct result{
+        std::string name;
+        double t;
+        bool constant_time;
+    };
+    std::vector <result> results;
+
+    // the fixed class uses equal operands, a zero mask or a zero shift
+    const inputs same = {value, value, 0};
+    const inputs zero = {0, 0, 0};
+
+    results.push_back({"ct_eq", measure(count, same, rng,
+        [](const inputs & in){ return ct_eq(in.a, in.b); }), true});
+    results.push_back({"ct_lt", measure(count, same, rng,
+        [](const inputs & in){ return ct_lt(in.a, in.b); }), true});
+    results.push_back({"ct_select", measure(count, same, rng,
+        [](const inputs & in){ return (uint64_t) ct_select((uint64_t) 0 - (in.x & 1), in.a, in.b); }), true});
+    results.push_back({"ct_swap", measure(count, same, rng,
+        [](const inputs & in){ uint256_t a = in.a, b = in.b; ct_swap((uint64_t) 0 - (in.x & 1), a, b); return (uint64_t) a; }), true});
+    results.push_back({"ct_shl", measure(count, same, rng,
+        [](const inputs & in){ return (uint64_t) ct_shl(in.a, in.x % 512); }), true});
+    results.push_back({"ct_shr", measure(count, same, rng,
+        [](const inputs & in){ return (uint64_t) ct_shr(in.a, in.x % 512); }), true});
+    results.push_back({"ct_mulmod", measure(count / 16, zero, rng,
+        [&p](const inputs & in){ return (uint64_t) ct_mulmod(in.a, in.b, p); }), true});
+
+    // references that branch on their operands, to show what a leak looks like
+    results.push_back({"operator<", measure(count, same, rng,
+        [](const inputs & in){ return (uint64_t) (in.a < in.b); }), false});
+    results.push_back({"operator%", measure(count, zero, rng,
+        [&p](const inputs & in){ return (uint64_t) (in.a % (in.b | 1)); }), false});
+
+    bool ok = true;
+    for(result const & r : results){
+        const bool leak = r.t > THRESHOLD;
+        std::cout << r.name << std::string(12 - r.name.size(), ' ')
+                  << "max |t| = " << r.t
+                  << (leak?"  timing depends on the inputs":"")
+                  << (r.constant_time?"":"  (reference)")
+                  << std::endl;
+        ok &= !(leak && r.constant_time);
+    }
+    return ok?0:1;
+}
@@ -1,3 +1,5 @@
+#include <cstring>
+
 #include <gtest/gtest.h>
 
 #include "uint256_t.h"
@@ -19,3 +21,16 @@ TEST(Accessor, data){
     EXPECT_EQ(value.lower().upper(), 0xfedcba9876543210ULL);
     EXPECT_EQ(value.lower().lower(), 0x0123456789abcdefULL);
 }
+
+TEST(Accessor, layout){
+    // both storage backends share the memory layout of two uint128_t halves
+    const uint256_t value(0xfedcba9876543210ULL, 0x0123456789abcdefULL, 0xf0e1d2c3b4a59687ULL, 0x78695a4b3c2d1e0fULL);
+    const uint128_t halves[2] = {value.lower(), value.upper()};
+    EXPECT_EQ(sizeof(uint256_t), sizeof(halves));
+#ifdef __BIG_ENDIAN__
+    const uint128_t expected[2] = {value.upper(), value.lower()};
+#else
+    const uint128_t expected[2] = {value.lower(), value.upper()};
+#endif
+    EXPECT_EQ(std::memcmp(&value, expected, sizeof(expected)), 0);
+}
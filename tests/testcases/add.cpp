@@ -42,3 +42,32 @@ TEST(External, add){
     EXPECT_EQ(u64  += val, (uint64_t) 0x9b9b9b9b9b9b9b9aULL);
     EXPECT_EQ(u128 += val, uint128_t (0x9b9b9b9b9b9b9b9bULL, 0x9b9b9b9b9b9b9b9aULL));
 }
+
+TEST(Arithmetic, add_carry){
+    const uint256_t max(0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL);
+
+    // carries ripple through every limb
+    EXPECT_EQ(uint256_t(0, 0, 0, 0xffffffffffffffffULL) + 1, uint256_t(0, 0, 1, 0));
+    EXPECT_EQ(uint256_t(0, 0, 0xffffffffffffffffULL, 0xffffffffffffffffULL) + 1, uint256_t(0, 1, 0, 0));
+    EXPECT_EQ(uint256_t(0, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL) + 1, uint256_t(1, 0, 0, 0));
+    EXPECT_EQ(max + 1, 0);
+    EXPECT_EQ(max + max, uint256_t(0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xfffffffffffffffeULL));
+
+    uint256_t value = uint256_t(0, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL);
+    EXPECT_EQ(++value, uint256_t(1, 0, 0, 0));
+    EXPECT_EQ(value += max, uint256_t(0, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL));
+}
+
+TEST(External, add_signed){
+    const uint256_t max(0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL);
+    EXPECT_EQ(uint256_t(0, 0, 0xffffffffffffffffULL, 0xffffffffffffffffULL) + (uint64_t) 0xffffffffffffffffULL, uint256_t(0, 1, 0, 0xfffffffffffffffeULL));
+
+    // negative operands are sign extended to 256 bits
+    EXPECT_EQ(uint256_t(5) + -1, 4);
+    EXPECT_EQ(uint256_t(0, 0, 1, 0) + (int8_t) -1, uint256_t(0, 0, 0, 0xffffffffffffffffULL));
+    EXPECT_EQ(uint256_t(0) + (int8_t) -2, max - 1);
+
+    uint256_t value(5);
+    EXPECT_EQ(value += -6, max);
+    EXPECT_EQ(value += 2u, 1);
+}
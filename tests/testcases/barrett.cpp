@@ -0,0 +1,86 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+static const uint256_t a(0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL);
+static const uint256_t b(0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL);
+
+static const std::vector <uint256_t> values = {
+    uint256_t(0),
+    uint256_t(1),
+    uint256_t(0xfedcba9876543210ULL),
+    uint256_t(0x0123456789abcdefULL, 0xfedcba9876543210ULL),
+    uint256_t(0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0xf0e1d2c3b4a59687ULL, 0x78695a4b3c2d1e0fULL),
+    uint256_t(0xffffffffffffffffULL, 0x0000000000000000ULL, 0xffffffffffffffffULL, 0x0000000000000000ULL),
+    a,
+    b,
+    uint256_max,
+};
+
+static const std::vector <uint256_t> moduli = {
+    uint256_t(1),
+    uint256_t(2),
+    uint256_t(3),
+    uint256_t(1000003),
+    uint256_t(0xffffffffffffffffULL),
+    uint256_t(0x0000000000000001ULL, 0x0000000000000000ULL),
+    uint256_t(0x0123456789abcdefULL, 0xfedcba9876543210ULL),
+    uint256_t(0x0000000000000000ULL, 0x8000000000000000ULL, 0xffffffffffffffffULL, 0x0000000000000001ULL),
+    uint256_t(0x8000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL),
+    montgomery_field <secp256k1_p>::modulus(),
+    uint256_max,
+};
+
+TEST(Barrett, reduce){
+    for(uint256_t const & m : moduli){
+        const barrett_context ctx(m);
+        EXPECT_EQ(ctx.modulus(), m);
+        for(uint256_t const & x : values){
+            EXPECT_EQ(ctx.reduce(x), x % m);
+            EXPECT_EQ(ctx.reduce(uint256_0, x), x % m);
+        }
+    }
+}
+
+TEST(Barrett, wide){
+    // (x * 2^256 + y) mod m == ((x mod m) * (2^256 mod m) + y) mod m
+    for(uint256_t const & m : moduli){
+        const barrett_context ctx(m);
+        const uint256_t r = ctx.reduce(uint256_1, uint256_0);
+        EXPECT_EQ(r, ctx.addmod(uint256_max % m, uint256_1 % m));
+        for(uint256_t const & x : values){
+            for(uint256_t const & y : values){
+                EXPECT_EQ(ctx.reduce(x, y), ctx.addmod(ctx.mulmod(x, r), y % m));
+                EXPECT_EQ(ctx.reduce(mul_wide(x, y)), ctx.mulmod(x, y));
+                EXPECT_EQ(ctx.mulmod(x, y), ctx.mulmod(x % m, y % m));
+            }
+        }
+    }
+}
+
+TEST(Barrett, secp256k1){
+    const barrett_context p(montgomery_field <secp256k1_p>::modulus());
+    EXPECT_EQ(p.mulmod(a, b),    uint256_t(0x8c644419c8c50984ULL, 0xe1e06f7bc8ebdb3cULL, 0x375c9addc912acf3ULL, 0x8dfac0488d5f655dULL));
+    EXPECT_EQ(p.mulmod(a, a),    uint256_t(0x9377533a571691dfULL, 0x3dfb27d856efc027ULL, 0xe87efc7656c8ee71ULL, 0x90bd993a3c120f76ULL));
+    EXPECT_EQ(p.addmod(a, b),    uint256_t(0x00000001000003d0ULL));
+    EXPECT_EQ(p.submod(b, a),    uint256_t(0x02468acf13579bdeULL, 0x02468acf13579bdeULL, 0x02468acf13579bdeULL, 0x02468ace1357980eULL));
+    EXPECT_EQ(p.submod(0, a),    uint256_t(0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456689abca1fULL));
+
+    const barrett_context n(montgomery_field <secp256k1_n>::modulus());
+    EXPECT_EQ(n.mulmod(a, b),    uint256_t(0xa5393281d581eac3ULL, 0x8aa0b5b7a4603985ULL, 0x62c086099ee7fe57ULL, 0x00c013d19c7b1d99ULL));
+    EXPECT_EQ(n.mulmod(a, a),    uint256_t(0x264d236379079004ULL, 0xaed079721c6f960fULL, 0x2b5269d506d4b9d2ULL, 0x6f8e54553afbfca3ULL));
+}
+
+TEST(Barrett, small){
+    const barrett_context ctx(1000003);
+    EXPECT_EQ(ctx.mulmod(999999, 999999), (999999ULL * 999999ULL) % 1000003);
+    EXPECT_EQ(ctx.addmod(999999, 999999), (2 * 999999ULL) % 1000003);
+    EXPECT_EQ(ctx.submod(0, 999999), 1000003 - 999999);
+    EXPECT_EQ(ctx.mulmod(uint256_max, uint256_max), ctx.mulmod(uint256_max % 1000003, uint256_max % 1000003));
+}
+
+TEST(Barrett, zero){
+    EXPECT_THROW(barrett_context(0), std::domain_error);
+}
@@ -0,0 +1,89 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+// every value whose limbs are one of a few that make carries and borrows
+// ripple, or that differ only in their sign bits
+static std::vector <uint256_t> limb_patterns(){
+    const uint64_t limbs[4] = {0, 1, 0x8000000000000000ULL, 0xffffffffffffffffULL};
+    std::vector <uint256_t> values;
+    for(int i = 0; i < 256; i++){
+        values.push_back(uint256_t(limbs[(i >> 6) & 3], limbs[(i >> 4) & 3], limbs[(i >> 2) & 3], limbs[i & 3]));
+    }
+    return values;
+}
+
+// pairs every pattern with every other one; the odd count leaves a tail
+// for the scalar loop after the vector kernels
+TEST(Batch, values){
+    const std::vector <uint256_t> patterns = limb_patterns();
+    const std::size_t n = patterns.size() - 1;
+    std::vector <uint256_t> rhs(n), out(n);
+    for(std::size_t shift = 0; shift < patterns.size(); shift++){
+        for(std::size_t i = 0; i < n; i++){
+            rhs[i] = patterns[(i + shift) % patterns.size()];
+        }
+
+        add_n(patterns.data(), rhs.data(), out.data(), n);
+        for(std::size_t i = 0; i < n; i++){
+            EXPECT_EQ(out[i], patterns[i] + rhs[i]);
+        }
+        sub_n(patterns.data(), rhs.data(), out.data(), n);
+        for(std::size_t i = 0; i < n; i++){
+            EXPECT_EQ(out[i], patterns[i] - rhs[i]);
+        }
+        and_n(patterns.data(), rhs.data(), out.data(), n);
+        for(std::size_t i = 0; i < n; i++){
+            EXPECT_EQ(out[i], patterns[i] & rhs[i]);
+        }
+        or_n(patterns.data(), rhs.data(), out.data(), n);
+        for(std::size_t i = 0; i < n; i++){
+            EXPECT_EQ(out[i], patterns[i] | rhs[i]);
+        }
+        xor_n(patterns.data(), rhs.data(), out.data(), n);
+        for(std::size_t i = 0; i < n; i++){
+            EXPECT_EQ(out[i], patterns[i] ^ rhs[i]);
+        }
+    }
+}
+
+TEST(Batch, masks){
+    const std::vector <uint256_t> patterns = limb_patterns();
+    const std::size_t n = patterns.size() - 1;
+    std::vector <uint256_t> rhs(n);
+    std::vector <uint64_t> mask(n);
+    for(std::size_t shift = 0; shift < patterns.size(); shift++){
+        for(std::size_t i = 0; i < n; i++){
+            rhs[i] = patterns[(i + shift) % patterns.size()];
+        }
+
+        lt_n(patterns.data(), rhs.data(), mask.data(), n);
+        for(std::size_t i = 0; i < n; i++){
+            EXPECT_EQ(mask[i], (patterns[i] < rhs[i])?0xffffffffffffffffULL:0);
+        }
+        eq_n(patterns.data(), rhs.data(), mask.data(), n);
+        for(std::size_t i = 0; i < n; i++){
+            EXPECT_EQ(mask[i], (patterns[i] == rhs[i])?0xffffffffffffffffULL:0);
+        }
+    }
+}
+
+TEST(Batch, in_place){
+    std::vector <uint256_t> values = {uint256_t(0, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL), uint256_max, uint256_0};
+    const std::vector <uint256_t> ones(values.size(), uint256_1);
+    add_n(values.data(), ones.data(), values.data(), values.size());
+    EXPECT_EQ(values[0], uint256_t(1, 0, 0, 0));
+    EXPECT_EQ(values[1], 0);
+    EXPECT_EQ(values[2], 1);
+
+    sub_n(ones.data(), values.data(), values.data(), values.size());
+    EXPECT_EQ(values[0], uint256_t(0xffffffffffffffffULL, 0, 0, 1));
+    EXPECT_EQ(values[1], 1);
+    EXPECT_EQ(values[2], 0);
+
+    // nothing to do
+    add_n(values.data(), ones.data(), values.data(), 0);
+    EXPECT_EQ(values[0], uint256_t(0xffffffffffffffffULL, 0, 0, 1));
+}
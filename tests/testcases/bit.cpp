@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+TEST(Bit, count_zero){
+    EXPECT_EQ(countl_zero(uint256_0), 256);
+    EXPECT_EQ(countr_zero(uint256_0), 256);
+    EXPECT_EQ(countl_zero(uint256_max), 0);
+    EXPECT_EQ(countr_zero(uint256_max), 0);
+
+    for(int i = 0; i < 256; i++){
+        const uint256_t bit = uint256_1 << i;
+        EXPECT_EQ(countl_zero(bit), 255 - i);
+        EXPECT_EQ(countr_zero(bit), i);
+        EXPECT_EQ(countl_zero(bit | uint256_1), 255 - i);
+        EXPECT_EQ(countr_zero(bit | (uint256_1 << 255)), i);
+        EXPECT_EQ(countl_zero(uint256_max >> i), i);
+        EXPECT_EQ(countr_zero(uint256_max << i), i);
+    }
+}
+
+TEST(Bit, popcount){
+    EXPECT_EQ(popcount(uint256_0), 0);
+    EXPECT_EQ(popcount(uint256_max), 256);
+    EXPECT_EQ(popcount(uint256_t(0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL)), 128);
+    for(int i = 0; i <= 256; i++){
+        EXPECT_EQ(popcount(uint256_max >> i), 256 - i);
+    }
+
+    EXPECT_FALSE(has_single_bit(uint256_0));
+    EXPECT_FALSE(has_single_bit(uint256_max));
+    for(int i = 0; i < 256; i++){
+        const uint256_t bit = uint256_1 << i;
+        EXPECT_TRUE(has_single_bit(bit));
+        EXPECT_EQ(has_single_bit(bit | uint256_1), i == 0);
+    }
+}
+
+TEST(Bit, bit_width){
+    EXPECT_EQ(bit_width(uint256_0), 0);
+    EXPECT_EQ(bit_width(uint256_max), 256);
+    for(int i = 0; i < 256; i++){
+        const uint256_t bit = uint256_1 << i;
+        EXPECT_EQ(bit_width(bit), i + 1);
+        EXPECT_EQ(bit_width((bit << 1) - 1), i + 1);
+        EXPECT_EQ(bit.bits(), i + 1);
+    }
+}
+
+TEST(Bit, rotate){
+    const uint256_t val(0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL);
+
+    EXPECT_EQ(rotl(val, 0), val);
+    EXPECT_EQ(rotl(val, 256), val);
+    EXPECT_EQ(rotr(val, 256), val);
+    EXPECT_EQ(rotl(val, 4), uint256_t(0x123456789abcdeffULL, 0xedcba98765432100ULL, 0xf1e2d3c4b5a69788ULL, 0x796a5b4c3d2e1f00ULL));
+    EXPECT_EQ(rotr(val, 4), uint256_t(0x00123456789abcdeULL, 0xffedcba987654321ULL, 0x00f1e2d3c4b5a697ULL, 0x88796a5b4c3d2e1fULL));
+
+    for(int i = 1; i < 256; i++){
+        const uint256_t left  = (val << i) | (val >> (256 - i));
+        const uint256_t right = (val >> i) | (val << (256 - i));
+        EXPECT_EQ(rotl(val, i), left);
+        EXPECT_EQ(rotr(val, i), right);
+        EXPECT_EQ(rotl(val, i + 256), left);
+        EXPECT_EQ(rotl(val, -i), right);
+        EXPECT_EQ(rotr(val, -i), left);
+        EXPECT_EQ(rotr(rotl(val, i), i), val);
+    }
+    EXPECT_EQ(rotl(val, INT32_MIN), val);
+    EXPECT_EQ(rotr(val, INT32_MIN), val);
+    EXPECT_EQ(rotl(val, INT32_MAX), rotr(val, 1));
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+TEST(Comparison, compare){
+    const uint256_t zero(0);
+    EXPECT_EQ(zero.compare(zero), 0);
+    EXPECT_EQ(uint256_max.compare(uint256_max), 0);
+    EXPECT_EQ(zero.compare(uint256_max), -1);
+    EXPECT_EQ(uint256_max.compare(zero), 1);
+
+    // values that only differ in one limb, with the other limbs equal and then not
+    for(int limb = 0; limb < 4; limb++){
+        const uint256_t small = uint256_t(5) << (64 * limb);
+        const uint256_t big   = uint256_t(6) << (64 * limb);
+        EXPECT_EQ(small.compare(big), -1);
+        EXPECT_EQ(big.compare(small), 1);
+        EXPECT_EQ(small.compare(small), 0);
+
+        // a larger lower limb does not outweigh a larger upper limb
+        const uint256_t low = (limb > 0)?((uint256_1 << (64 * limb)) - 1):uint256_0;
+        EXPECT_EQ((small | low).compare(big), -1);
+        EXPECT_EQ(big.compare(small | low), 1);
+    }
+}
+
+TEST(Comparison, relational){
+    // every operator agrees with compare
+    const uint256_t values[] = {
+        uint256_t(0),
+        uint256_t(1),
+        uint256_t(0xffffffffffffffffULL),
+        uint256_t(1, 0),
+        uint256_t(0, 0, 1, 0),
+        uint256_t(0xffffffffffffffffULL, 0, 0, 0),
+        uint256_t(0xffffffffffffffffULL, 0, 0, 1),
+        uint256_max,
+    };
+    for(const uint256_t & lhs : values){
+        for(const uint256_t & rhs : values){
+            const int c = lhs.compare(rhs);
+            EXPECT_EQ(lhs <  rhs, c <  0);
+            EXPECT_EQ(lhs <= rhs, c <= 0);
+            EXPECT_EQ(lhs >  rhs, c >  0);
+            EXPECT_EQ(lhs >= rhs, c >= 0);
+            EXPECT_EQ(lhs == rhs, c == 0);
+            EXPECT_EQ(lhs != rhs, c != 0);
+            EXPECT_EQ(rhs.compare(lhs), -c);
+
+            // the same through the uint128_t overloads
+            if (!rhs.upper()){
+                EXPECT_EQ(lhs <  rhs.lower(), c <  0);
+                EXPECT_EQ(lhs <= rhs.lower(), c <= 0);
+                EXPECT_EQ(lhs >  rhs.lower(), c >  0);
+                EXPECT_EQ(lhs >= rhs.lower(), c >= 0);
+                EXPECT_EQ(lhs == rhs.lower(), c == 0);
+                EXPECT_EQ(lhs != rhs.lower(), c != 0);
+            }
+        }
+    }
+}
+
+#ifdef UINT256_T_HAS_THREE_WAY_COMPARISON
+TEST(Comparison, three_way){
+    const uint256_t small(0, 0, 1, 0);
+    const uint256_t big(1, 0, 0, 0);
+    EXPECT_TRUE((small <=> big) == std::strong_ordering::less);
+    EXPECT_TRUE((big <=> small) == std::strong_ordering::greater);
+    EXPECT_TRUE((big <=> big) == std::strong_ordering::equal);
+}
+#endif
+
+#ifdef UINT256_T_LIMBS
+TEST(Constexpr, compare){
+    constexpr uint256_t small(0, 0, 1, 0);
+    constexpr uint256_t big(1, 0, 0, 0);
+    static_assert(small.compare(big) == -1, "small < big");
+    static_assert(big.compare(small) == 1, "big > small");
+    static_assert(big.compare(big) == 0, "big == big");
+    static_assert((small <= big) && (big >= small) && !(big <= small), "relational operators");
+    EXPECT_EQ(small.compare(big), -1);
+}
+#endif
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+static const uint64_t CT_TRUE  = 0xffffffffffffffffULL;
+static const uint64_t CT_FALSE = 0;
+
+static const uint256_t A("fedcba9876543210fedcba9876543210fedcba9876543210fedcba9876543210", 16);
+static const uint256_t B("0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef", 16);
+
+TEST(Constant_Time, eq){
+    EXPECT_EQ(ct_eq(A, A), CT_TRUE);
+    EXPECT_EQ(ct_eq(A, B), CT_FALSE);
+    EXPECT_EQ(ct_eq(0, 0), CT_TRUE);
+    EXPECT_EQ(ct_eq(uint256_1 << 255, 0), CT_FALSE);
+    EXPECT_EQ(ct_eq(uint256_max, uint256_max), CT_TRUE);
+}
+
+TEST(Constant_Time, lt){
+    EXPECT_EQ(ct_lt(B, A), CT_TRUE);
+    EXPECT_EQ(ct_lt(A, B), CT_FALSE);
+    EXPECT_EQ(ct_lt(A, A), CT_FALSE);
+    EXPECT_EQ(ct_lt(0, 1), CT_TRUE);
+    EXPECT_EQ(ct_lt(uint256_max - 1, uint256_max), CT_TRUE);
+    EXPECT_EQ(ct_lt(uint256_1 << 128, uint256_t(uint128_t(0), uint128_t(-1))), CT_FALSE);
+}
+
+TEST(Constant_Time, select){
+    EXPECT_EQ(ct_select(CT_TRUE, A, B), A);
+    EXPECT_EQ(ct_select(CT_FALSE, A, B), B);
+    EXPECT_EQ(ct_select(ct_lt(B, A), A, B), A);
+}
+
+TEST(Constant_Time, swap){
+    uint256_t a = A, b = B;
+    ct_swap(CT_FALSE, a, b);
+    EXPECT_EQ(a, A);
+    EXPECT_EQ(b, B);
+    ct_swap(CT_TRUE, a, b);
+    EXPECT_EQ(a, B);
+    EXPECT_EQ(b, A);
+}
+
+TEST(Constant_Time, shift){
+    for(uint64_t shift = 0; shift < 300; shift++){
+        EXPECT_EQ(ct_shl(A, shift), (shift < 256)?(A << shift):uint256_0);
+        EXPECT_EQ(ct_shr(A, shift), (shift < 256)?(A >> shift):uint256_0);
+    }
+    EXPECT_EQ(ct_shl(A, 0x100000000ULL), 0);
+    EXPECT_EQ(ct_shr(A, 0xffffffffffffffffULL), 0);
+}
+
+TEST(Constant_Time, mulmod){
+    const uint256_t p("fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f", 16);
+    const uint256_t even("1000000000000000000000000000000000000000000000000000000000000", 16);
+    for(uint256_t const & mod : {p, even, uint256_t(97), uint256_max}){
+        const barrett_context ctx(mod);
+        EXPECT_EQ(ct_mulmod(A, B, mod), ctx.mulmod(A, B));
+        EXPECT_EQ(ct_mulmod(A, A, mod), ctx.mulmod(A, A));
+        EXPECT_EQ(ct_mulmod(0, B, mod), 0);
+    }
+    EXPECT_EQ(ct_mulmod(A, B, 1), 0);
+    EXPECT_THROW(ct_mulmod(A, B, 0), std::domain_error);
+}
@@ -22,6 +22,57 @@ TEST(Constructor, base_string){
     EXPECT_EQ(uint256_t("31415926", 10), 0x01df5e76ULL);
 }
 
+TEST(Constructor, base_string_chunks){
+    // more digits than fit in a limb
+    EXPECT_EQ(uint256_t("18446744073709551616", 10), uint256_t(0, 0, 1, 0));
+    EXPECT_EQ(uint256_t("340282366920938463463374607431768211455", 10), uint256_t(0ULL, 0ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL));
+    EXPECT_EQ(uint256_t("10000000000000000", 16), uint256_t(0, 0, 1, 0));
+    EXPECT_EQ(uint256_t("0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001", 10), 1);
+
+    // uppercase digits and prefixes
+    EXPECT_EQ(uint256_t("FEDCBA9876543210", 16), 0xfedcba9876543210ULL);
+    EXPECT_EQ(uint256_t("0xFEDCBA9876543210", 16), 0xfedcba9876543210ULL);
+    EXPECT_EQ(uint256_t("0b101", 2), 5);
+    EXPECT_EQ(uint256_t("10NCMSS", 36), 2216002924);
+}
+
+TEST(Constructor, base_string_errors){
+    EXPECT_THROW(uint256_t("123z", 10), std::invalid_argument);
+    EXPECT_THROW(uint256_t("12 3", 10), std::invalid_argument);
+    EXPECT_THROW(uint256_t("-1",   10), std::invalid_argument);
+    EXPECT_THROW(uint256_t("2",    2),  std::invalid_argument);
+    EXPECT_THROW(uint256_t("1",    1),  std::invalid_argument);
+    EXPECT_THROW(uint256_t("1",    37), std::invalid_argument);
+
+    // a prefix with no digits after it
+    EXPECT_THROW(uint256_t("0x"), std::invalid_argument);
+    EXPECT_THROW(uint256_t("0X", 16), std::invalid_argument);
+    EXPECT_THROW(uint256_t("0b"), std::invalid_argument);
+    EXPECT_THROW(uint256_t("0B", 2), std::invalid_argument);
+
+    // no digits at all
+    EXPECT_THROW(uint256_t(""), std::invalid_argument);
+    EXPECT_THROW(uint256_t("", 16), std::invalid_argument);
+    EXPECT_THROW(uint256_t(std::string()), std::invalid_argument);
+
+    // a std::string is parsed up to its size, not up to an embedded null
+    EXPECT_THROW(uint256_t(std::string("12\0" "34", 5)), std::invalid_argument);
+    EXPECT_THROW(uint256_t(std::string("ff\0", 3), 16), std::invalid_argument);
+
+    // one more than uint256_max
+    EXPECT_THROW(uint256_t("115792089237316195423570985008687907853269984665640564039457584007913129639936", 10), std::out_of_range);
+    EXPECT_THROW(uint256_t("10000000000000000000000000000000000000000000000000000000000000000", 16), std::out_of_range);
+}
+
+TEST(Constructor, string){
+    EXPECT_EQ(uint256_t("31415926"), 0x01df5e76ULL);
+    EXPECT_EQ(uint256_t(std::string("31415926")), 0x01df5e76ULL);
+    EXPECT_EQ(uint256_t("0x0123456789abcdef"), 0x0123456789abcdefULL);
+    EXPECT_EQ(uint256_t("0X0123456789ABCDEF"), 0x0123456789abcdefULL);
+    EXPECT_EQ(uint256_t("0b111101101"), 0x01ed);
+    EXPECT_EQ(uint256_t("115792089237316195423570985008687907853269984665640564039457584007913129639935"), uint256_max);
+}
+
 TEST(Constructor, one){
     EXPECT_EQ(uint256_t(true).upper(),  false);
     EXPECT_EQ(uint256_t(true).lower(),   true);
@@ -15,6 +15,32 @@ TEST(Arithmetic, divide){
     EXPECT_THROW(uint256_t(1) / uint256_t(0), std::domain_error);
 }
 
+TEST(Arithmetic, divide_multi_limb){
+    const uint256_t a(0xfedcba9876543210ULL, 0xf0e1d2c3b4a59687ULL, 0x78695a4b3c2d1e0fULL, 0x0123456789abcdefULL);
+    const uint256_t b(0x0000000000000000ULL, 0x0000000000000001ULL, 0xfffffffffffffffeULL, 0x0000000000000003ULL);
+    EXPECT_EQ(a / b, uint256_t(0x0000000000000000ULL, 0x0000000000000000ULL, 0x7f6e5d4c3b2a1908ULL, 0xf7df46ae157ce44bULL));
+
+    // quotient digit estimate needs correcting
+    const uint256_t c(0x8000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x7fffffffffffffffULL);
+    const uint256_t d(0x0000000000000000ULL, 0x8000000000000000ULL, 0xffffffffffffffffULL, 0x0000000000000001ULL);
+    EXPECT_EQ(c / d, uint256_t(0xfffffffffffffffeULL));
+
+    EXPECT_EQ(uint256_max / uint256_t(0xfedcba9876543210ULL, 0, 0, 0), uint256_t(1));
+    EXPECT_EQ(uint256_max / uint256_t(0x10ULL), uint256_max >> 4);
+}
+
+TEST(Arithmetic, divide_single_limb){
+    EXPECT_EQ(uint256_max / 10, uint256_t(0x1999999999999999ULL, 0x9999999999999999ULL, 0x9999999999999999ULL, 0x9999999999999999ULL));
+    EXPECT_EQ(uint256_max / 1000000000000000000ULL, uint256_t(0x0000000000000012ULL, 0x725dd1d243aba0e7ULL, 0x5fe645cc4873f9e6ULL, 0x5afe688c928e1f21ULL));
+    EXPECT_EQ(uint256_max / 0xfffffffffffffffdULL, uint256_t(0x0000000000000001ULL, 0x0000000000000003ULL, 0x0000000000000009ULL, 0x000000000000001bULL));
+
+    // negative divisors are sign extended to 256 bits
+    EXPECT_EQ(uint256_t(0x1234ULL) / -1, 0);
+    EXPECT_EQ(uint256_max / -1, 1);
+
+    EXPECT_THROW(uint256_t(1) / 0, std::domain_error);
+}
+
 TEST(External, divide){
     bool      t    = true;
     bool      f    = false;
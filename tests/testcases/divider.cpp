@@ -0,0 +1,72 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+static const std::vector <uint256_t> numerators = {
+    uint256_t(0),
+    uint256_t(1),
+    uint256_t(0xfedcba9876543210ULL),
+    uint256_t(0x0123456789abcdefULL, 0xfedcba9876543210ULL),
+    uint256_t(0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0xf0e1d2c3b4a59687ULL, 0x78695a4b3c2d1e0fULL),
+    uint256_t(0xffffffffffffffffULL, 0x0000000000000000ULL, 0xffffffffffffffffULL, 0x0000000000000000ULL),
+    uint256_max,
+};
+
+static const std::vector <uint256_t> divisors = {
+    uint256_t(1),
+    uint256_t(3),
+    uint256_t(10),
+    uint256_t(0x10ULL),
+    uint256_t(1000000000000000000ULL),
+    uint256_t(0xffffffffffffffffULL),
+    uint256_t(0x0000000000000001ULL, 0x0000000000000000ULL),
+    uint256_t(0x0123456789abcdefULL, 0xfedcba9876543210ULL),
+    uint256_t(0x0000000000000000ULL, 0x8000000000000000ULL, 0xffffffffffffffffULL, 0x0000000000000001ULL),
+    uint256_t(0xfedcba9876543210ULL, 0xf0e1d2c3b4a59687ULL, 0x78695a4b3c2d1e0fULL, 0x0123456789abcdefULL),
+    uint256_max,
+};
+
+TEST(Divider, divmod){
+    for(uint256_t const & d : divisors){
+        const uint256_divider divider(d);
+        EXPECT_EQ(divider.value(), d);
+        for(uint256_t const & n : numerators){
+            EXPECT_EQ(divider.quotient(n),  n / d);
+            EXPECT_EQ(divider.remainder(n), n % d);
+            EXPECT_EQ(n / divider, n / d);
+            EXPECT_EQ(n % divider, n % d);
+        }
+    }
+}
+
+TEST(Divider, assignment){
+    const uint256_divider divider(1000000000000000000ULL);
+
+    uint256_t value = uint256_max;
+    value /= divider;
+    EXPECT_EQ(value, uint256_t(0x0000000000000012ULL, 0x725dd1d243aba0e7ULL, 0x5fe645cc4873f9e6ULL, 0x5afe688c928e1f21ULL));
+
+    value = uint256_max;
+    value %= divider;
+    EXPECT_EQ(value, 584007913129639935ULL);
+}
+
+TEST(Divider, divides){
+    for(uint256_t const & d : divisors){
+        const uint256_divider divider(d);
+        for(uint256_t const & n : numerators){
+            const uint256_t multiple = n - n % d;
+            EXPECT_TRUE(divider.divides(multiple));
+            if ((d != 1) && (multiple != uint256_max)){
+                EXPECT_FALSE(divider.divides(multiple + 1));
+            }
+            EXPECT_EQ(divider.divides(n), !(n % d));
+        }
+    }
+}
+
+TEST(Divider, zero){
+    EXPECT_THROW(uint256_divider(0), std::domain_error);
+}
@@ -1,4 +1,5 @@
 #include <map>
+#include <random>
 
 #include <gtest/gtest.h>
 
@@ -59,6 +60,120 @@ TEST(Function, str){
     }
 }
 
+TEST(Function, str_wide){
+    EXPECT_EQ(uint256_max.str(10), "115792089237316195423570985008687907853269984665640564039457584007913129639935");
+    EXPECT_EQ(uint256_max.str(36), "6dp5qcb22im238nr3wvp0ic7q99w035jmy2iw7i6n43d37jtof");
+    EXPECT_EQ(uint256_max.str(10, 80), "00115792089237316195423570985008687907853269984665640564039457584007913129639935");
+
+    // chunks made of zeros must keep their digits
+    const uint256_t power = uint256_t(10000000000000000000ULL) * uint256_t(10000000000000000000ULL) * uint256_t(100);
+    EXPECT_EQ(power.str(10), "10000000000000000000000000000000000000000");
+    EXPECT_EQ((power + 7).str(10), "10000000000000000000000000000000000000007");
+}
+
+// Builds the expected strings one digit at a time with % and / over random
+// values of every width, and compares them with str(base, len)
+TEST(Function, str_random){
+    static const char digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+    std::mt19937_64 gen(0x5eed);
+
+    for(unsigned int i = 0; i < 1000; i++){
+        const uint64_t a = gen(), b = gen(), c = gen(), d = gen();
+        const uint256_t original = uint256_t(a, b, c, d) >> (unsigned int) (gen() % 256);
+        const unsigned int len = (unsigned int) (gen() % 80);
+
+        for(uint8_t base = 2; base <= 36; base++){
+            std::string expected;
+            uint256_t value = original;
+            do{
+                expected.insert(expected.begin(), digits[(uint8_t) (value % base)]);
+                value /= base;
+            } while (value);
+            if (expected.size() < len){
+                expected.insert(expected.begin(), len - expected.size(), '0');
+            }
+
+            EXPECT_EQ(original.str(base, len), expected) << original.str(16) << " " << (unsigned int) base << " " << len;
+        }
+    }
+}
+
+TEST(Function, str_power_of_2){
+    const uint256_t value(0xfedcba9876543210ULL, 0xf0e1d2c3b4a59687ULL, 0x78695a4b3c2d1e0fULL, 0x0123456789abcdefULL);
+
+    // base 8 and base 32 digits straddle limbs
+    EXPECT_EQ(value.str(8),  "17733456514166250310207416072260732245455035703225511317026436036004432126361152746757");
+    EXPECT_EQ(value.str(32), "1vmsnac7cl1i23oe3km3miipd1rod5d4mf1d3o7g28q5cu4qnjff");
+    EXPECT_EQ(value.str(16), "fedcba9876543210f0e1d2c3b4a5968778695a4b3c2d1e0f0123456789abcdef");
+    EXPECT_EQ(uint256_max.str(8), "17777777777777777777777777777777777777777777777777777777777777777777777777777777777777");
+    EXPECT_EQ(uint256_max.str(2), std::string(256, '1'));
+
+    EXPECT_EQ(uint256_t(0).str(16),    "0");
+    EXPECT_EQ(uint256_t(0).str(16, 4), "0000");
+    EXPECT_EQ(uint256_t(0xabcULL).str(16, 8), "00000abc");
+}
+
+TEST(Function, str_uppercase){
+    const uint256_t value(0xfedcba9876543210ULL, 0xf0e1d2c3b4a59687ULL, 0x78695a4b3c2d1e0fULL, 0x0123456789abcdefULL);
+    EXPECT_EQ(value.str(16, 0, true), "FEDCBA9876543210F0E1D2C3B4A5968778695A4B3C2D1E0F0123456789ABCDEF");
+    EXPECT_EQ(uint256_t(0xabcULL).str(16, 8, true), "00000ABC");
+    EXPECT_EQ(uint256_t(2216002924).str(36, 0, true), "10NCMSS");
+}
+
+TEST(Function, to_chars){
+    char buf[80];
+
+    const uint256_to_chars_result dec = to_chars(buf, buf + sizeof(buf), uint256_max);
+    EXPECT_EQ(dec.ec, std::errc());
+    EXPECT_EQ(std::string(buf, dec.ptr), "115792089237316195423570985008687907853269984665640564039457584007913129639935");
+
+    const uint256_to_chars_result hex = to_chars(buf, buf + sizeof(buf), uint256_t(0xfedcba9876543210ULL), 16);
+    EXPECT_EQ(hex.ec, std::errc());
+    EXPECT_EQ(std::string(buf, hex.ptr), "fedcba9876543210");
+
+    const uint256_to_chars_result zero = to_chars(buf, buf + sizeof(buf), uint256_t(0), 36);
+    EXPECT_EQ(zero.ec, std::errc());
+    EXPECT_EQ(std::string(buf, zero.ptr), "0");
+
+    // one character short
+    const uint256_to_chars_result small = to_chars(buf, buf + 15, uint256_t(0xfedcba9876543210ULL), 16);
+    EXPECT_EQ(small.ec, std::errc::value_too_large);
+    EXPECT_EQ(small.ptr, buf + 15);
+
+    EXPECT_EQ(to_chars(buf, buf + sizeof(buf), uint256_t(1), 37).ec, std::errc::invalid_argument);
+}
+
+TEST(Function, from_chars){
+    const std::string dec = "115792089237316195423570985008687907853269984665640564039457584007913129639935 trailing";
+    uint256_t value;
+    const uint256_from_chars_result max = from_chars(dec.data(), dec.data() + dec.size(), value);
+    EXPECT_EQ(max.ec, std::errc());
+    EXPECT_EQ(max.ptr, dec.data() + 78);
+    EXPECT_EQ(value, uint256_max);
+
+    const std::string hex = "FEDCBA9876543210xyz";
+    const uint256_from_chars_result upper = from_chars(hex.data(), hex.data() + hex.size(), value, 16);
+    EXPECT_EQ(upper.ec, std::errc());
+    EXPECT_EQ(upper.ptr, hex.data() + 16);
+    EXPECT_EQ(value, 0xfedcba9876543210ULL);
+
+    // no digits leaves the value alone
+    const std::string none = "-1";
+    const uint256_from_chars_result invalid = from_chars(none.data(), none.data() + none.size(), value);
+    EXPECT_EQ(invalid.ec, std::errc::invalid_argument);
+    EXPECT_EQ(invalid.ptr, none.data());
+    EXPECT_EQ(value, 0xfedcba9876543210ULL);
+
+    // too large consumes all of the digits and leaves the value alone
+    const std::string big = "115792089237316195423570985008687907853269984665640564039457584007913129639936";
+    const uint256_from_chars_result overflow = from_chars(big.data(), big.data() + big.size(), value);
+    EXPECT_EQ(overflow.ec, std::errc::result_out_of_range);
+    EXPECT_EQ(overflow.ptr, big.data() + big.size());
+    EXPECT_EQ(value, 0xfedcba9876543210ULL);
+
+    EXPECT_EQ(from_chars(big.data(), big.data() + big.size(), value, 1).ec, std::errc::invalid_argument);
+}
+
 TEST(Function, export_bits){
     const uint64_t u64 = 0x0123456789abcdefULL;
     const uint256_t value = u64;
@@ -103,6 +218,10 @@ TEST(External, ostream){
     std::stringstream hex; hex << std::hex << value;
     EXPECT_EQ(hex.str(), "fedcba9876543210");
 
+    // write out uppercase hexadecimal uint256_t
+    std::stringstream upper; upper << std::hex << std::uppercase << value;
+    EXPECT_EQ(upper.str(), "FEDCBA9876543210");
+
     // zero
     std::stringstream zero; zero << uint256_t();
     EXPECT_EQ(zero.str(), "0");
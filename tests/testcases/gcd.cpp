@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+TEST(GCD, small){
+    EXPECT_EQ(gcd(12, 18), 6);
+    EXPECT_EQ(gcd(18, 12), 6);
+    EXPECT_EQ(gcd(17, 5), 1);
+    EXPECT_EQ(gcd(1024, 96), 32);
+    EXPECT_EQ(gcd(7, 7), 7);
+}
+
+TEST(GCD, zero){
+    EXPECT_EQ(gcd(0, 0), 0);
+    EXPECT_EQ(gcd(0, 42), 42);
+    EXPECT_EQ(gcd(42, 0), 42);
+    EXPECT_EQ(gcd(uint256_max, 0), uint256_max);
+}
+
+TEST(GCD, powers_of_two){
+    EXPECT_EQ(gcd(uint256_1 << 255, uint256_1 << 100), uint256_1 << 100);
+    EXPECT_EQ(gcd(uint256_t(3) << 200, uint256_t(5) << 150), uint256_1 << 150);
+    EXPECT_EQ(gcd(uint256_1 << 255, uint256_max), 1);
+}
+
+TEST(GCD, mixed_widths){
+    const uint256_t large("fedcba9876543210fedcba9876543210fedcba987654321", 16);
+    const uint256_t mid("123456789abcdef0123456789abcdef", 16);
+    const uint256_t factor("1000000000000000b", 16);
+
+    // 64 bit
+    EXPECT_EQ(gcd(large * 97, 97 * 89), 97);
+    EXPECT_EQ(gcd(97 * 89, large * 97), 97);
+    EXPECT_EQ(gcd(large, 1), 1);
+    EXPECT_EQ(gcd(large * 3, 3), 3);
+
+    // 128 bit
+    EXPECT_EQ(gcd(mid * factor, large * factor) % factor, 0);
+    EXPECT_EQ(gcd(mid * 6, mid * 10), mid * 2);
+    EXPECT_EQ(gcd(large, mid), gcd(mid, large % mid));
+}
+
+TEST(GCD, wide){
+    const uint256_t a("3c9e2f7fb4d6a18d0c5e8b91f2a37d4650b9e1c83f7a2d6e19c4b58a07f3e2d1", 16);
+    const uint256_t b("1f2e3d4c5b6a79880123456789abcdeffedcba9876543210", 16);
+    const uint256_t g("b504f333f9de6485", 16);
+    EXPECT_EQ(gcd(a, b), gcd(b, a % b));
+    EXPECT_EQ(gcd(g * 0x10001, g * 0x10003), g);
+    EXPECT_EQ(gcd(uint256_max, uint256_max - 2), 1);
+    EXPECT_EQ(gcd(uint256_max, uint256_t(0xffffffffULL) * 0x100000001ULL), 0xffffffffffffffffULL);
+}
+
+TEST(LCM, all){
+    EXPECT_EQ(lcm(4, 6), 12);
+    EXPECT_EQ(lcm(6, 4), 12);
+    EXPECT_EQ(lcm(0, 6), 0);
+    EXPECT_EQ(lcm(6, 0), 0);
+    EXPECT_EQ(lcm(uint256_1 << 100, uint256_1 << 200), uint256_1 << 200);
+    EXPECT_EQ(lcm(uint256_t(3) << 128, uint256_t(5) << 64), uint256_t(15) << 128);
+}
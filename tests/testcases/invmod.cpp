@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+static const uint256_t SECP256K1_P("fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f", 16);
+static const uint256_t SECP256K1_N("fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141", 16);
+
+TEST(Invmod, small){
+    EXPECT_EQ(invmod(3, 7), 5);
+    EXPECT_EQ(invmod(10, 17), 12);
+    EXPECT_EQ(invmod(1, 9), 1);
+    EXPECT_EQ(invmod(8, 9), 8);
+    EXPECT_EQ(invmod(5, 1), 0);
+}
+
+TEST(Invmod, prime){
+    const uint256_t moduli[] = {
+        SECP256K1_P,
+        SECP256K1_N,
+        uint256_t("7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffed", 16),    // 2^255 - 19
+        uint256_t("7fffffffffffffffffffffffffffffff", 16),                                    // 2^127 - 1
+        uint256_t(0xffffffffffffffc5ULL),                                                    // 2^64 - 59
+    };
+
+    uint256_t value("123456789abcdef0fedcba9876543210deadbeefcafebabe0123456789abcdef", 16);
+    for(uint256_t const & mod : moduli){
+        const barrett_context ctx(mod);
+        const uint256_t fermat = mod - 2;
+        for(int i = 0; i < 20; i++){
+            value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+            const uint256_t v = value % mod;
+            if (!v){
+                continue;
+            }
+            const uint256_t inverse = invmod(v, mod);
+            EXPECT_LT(inverse, mod);
+            EXPECT_EQ(ctx.mulmod(inverse, v), 1);
+            EXPECT_EQ(inverse, powmod(v, fermat, mod));
+        }
+    }
+}
+
+TEST(Invmod, composite){
+    const uint256_t mod = uint256_max;
+    const barrett_context ctx(mod);
+    uint256_t value("0f1e2d3c4b5a69788796a5b4c3d2e1f00123456789abcdef0fedcba987654321", 16);
+    for(int i = 0; i < 20; i++){
+        value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+        try{
+            EXPECT_EQ(ctx.mulmod(invmod(value, mod), value), 1);
+        }
+        catch (std::domain_error &){
+            // 2^256 - 1 = 3 * 5 * 17 * 257 * ...
+            EXPECT_TRUE(!(value % 3) || !(value % 5) || !(value % 17) || !(value % 257) || !(value % 641) || !(value % 65537) || !(value % 274177) || !(value % 6700417));
+        }
+    }
+
+    EXPECT_EQ(ctx.mulmod(invmod(2, mod), 2), 1);
+    EXPECT_EQ(invmod(uint256_max - 1, mod), uint256_max - 1);
+}
+
+TEST(Invmod, reduced){
+    EXPECT_EQ(invmod(SECP256K1_P + 3, SECP256K1_P), invmod(3, SECP256K1_P));
+    EXPECT_EQ(invmod(uint256_max, SECP256K1_N), invmod(uint256_max % SECP256K1_N, SECP256K1_N));
+}
+
+TEST(Invmod, no_inverse){
+    EXPECT_THROW(invmod(0, 7), std::domain_error);
+    EXPECT_THROW(invmod(6, 9), std::domain_error);
+    EXPECT_THROW(invmod(SECP256K1_P, SECP256K1_P), std::domain_error);
+    EXPECT_THROW(invmod(uint256_t(3) << 200, uint256_t(3) << 100 | 3), std::domain_error);
+}
+
+TEST(Invmod, even){
+    EXPECT_THROW(invmod(3, 0), std::invalid_argument);
+    EXPECT_THROW(invmod(3, 8), std::invalid_argument);
+}
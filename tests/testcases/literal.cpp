@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+TEST(Literal, decimal){
+    EXPECT_EQ(0_u256, 0);
+    EXPECT_EQ(1234567890_u256, 1234567890);
+    EXPECT_EQ(18446744073709551616_u256, uint256_t(0, 0, 1, 0));
+    EXPECT_EQ(115792089237316195423570985008687907853269984665640564039457584007913129639935_u256, uint256_max);
+    EXPECT_EQ(57896044618658097711785492504343953926634992332820282019728792003956564819949_u256,
+              uint256_t("57896044618658097711785492504343953926634992332820282019728792003956564819949", 10));
+}
+
+TEST(Literal, hexadecimal){
+    EXPECT_EQ(0x0_u256, 0);
+    EXPECT_EQ(0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_u256,
+              uint256_t("fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f", 16));
+    EXPECT_EQ(0XDEADBEEFCAFEBABE0123456789ABCDEF_u256, uint256_t(uint128_t(0), uint128_t(0xdeadbeefcafebabeULL, 0x0123456789abcdefULL)));
+    EXPECT_EQ(0xFfFf_u256, 0xffff);
+}
+
+TEST(Literal, octal){
+    EXPECT_EQ(0777_u256, 0777);
+    EXPECT_EQ(017777777777777777777777777777777777777777777777777777777777777777777777777777777777777_u256, uint256_max);
+}
+
+// binary literals and digit separators are C++14
+#if __cplusplus >= 201402L
+TEST(Literal, binary){
+    EXPECT_EQ(0b1011_u256, 11);
+    EXPECT_EQ(0B1_u256 << 255, uint256_t(1) << 255);
+}
+
+TEST(Literal, separators){
+    EXPECT_EQ(1'000'000_u256, 1000000);
+    EXPECT_EQ(0xffff'ffff'ffff'ffff'ffff_u256, uint256_t(0, 0, 0xffff, 0xffffffffffffffffULL));
+}
+#endif
+
+#ifdef UINT256_T_LIMBS
+TEST(Constexpr, limbs){
+    constexpr uint256_t p = 0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_u256;
+    constexpr uint256_t n = 0xfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141_u256;
+    static_assert(n < p, "");
+    static_assert(p > n, "");
+    static_assert(n <= p && p >= n && n <= n, "");
+    static_assert(p != n && p == p, "");
+    static_assert((p & n) == 0xfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364001_u256, "");
+    static_assert((p | 1) == p, "");
+    static_assert((p ^ p) == 0, "");
+    static_assert(~uint256_t(0) == uint256_t((uint64_t) -1, (uint64_t) -1, (uint64_t) -1, (uint64_t) -1), "");
+    static_assert(!uint256_t(0) && (bool) p, "");
+    static_assert((uint64_t) p == 0xfffffffefffffc2fULL, "");
+    static_assert(uint256_t(-1) == ~uint256_t(0), "");
+    static_assert(uint256_t(1, 2) == 0x100000000000000000000000000000002_u256, "");
+    static_assert(p > 5 && p != 5 && (1 | p) == p, "");
+    static_assert(p + (n - p) == n, "");
+    static_assert(uint256_t((uint64_t) -1, (uint64_t) -1, (uint64_t) -1, (uint64_t) -1) + 1 == 0, "");
+    static_assert(0x1ffffffffffffffffffffffffffffffff_u256 + 1 == 0x200000000000000000000000000000000_u256, "");
+    static_assert(0x200000000000000000000000000000000_u256 - 1 == 0x1ffffffffffffffffffffffffffffffff_u256, "");
+    static_assert(uint256_t(0) - 1 == ~uint256_t(0), "");
+    static_assert(p - 0xfffffffefffffc2f == 0xffffffffffffffffffffffffffffffffffffffffffffffff0000000000000000_u256, "");
+
+    // still usable at run time
+    uint256_t x = p;
+    EXPECT_TRUE(n < x);
+    EXPECT_EQ(x & n, 0xfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364001_u256);
+}
+
+#if __cplusplus >= 201703L
+TEST(Constexpr, constants){
+    static_assert(uint256_0 == 0, "");
+    static_assert(uint256_1 == 1, "");
+    static_assert(uint256_max == ~uint256_0, "");
+}
+#endif
+#endif
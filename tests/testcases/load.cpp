@@ -0,0 +1,73 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+static const std::string path = "uint256_t_load_test.txt";
+
+static void write_file(const std::string & contents){
+    std::ofstream file(path.c_str(), std::ios::binary);
+    file << contents;
+}
+
+TEST(Load, decimal){
+    std::string contents;
+    for(uint64_t i = 0; i < 1000; i++){
+        contents += (uint256_max - i).str(10) + "\n";
+    }
+    write_file(contents);
+
+    for(unsigned int threads = 0; threads < 8; threads++){
+        const uint256_load_result result = load_uint256_file(path, 10, threads);
+        ASSERT_EQ(result.values.size(), 1000);
+        for(uint64_t i = 0; i < 1000; i++){
+            EXPECT_EQ(result.values[i], uint256_max - i);
+        }
+        EXPECT_TRUE(result.malformed.empty());
+    }
+    std::remove(path.c_str());
+}
+
+TEST(Load, hexadecimal){
+    write_file("0xfedcba9876543210\r\nFEDCBA9876543210\r\n0\r\nffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff");
+
+    const uint256_load_result result = load_uint256_file(path, 16);
+    ASSERT_EQ(result.values.size(), 4);
+    EXPECT_EQ(result.values[0], 0xfedcba9876543210ULL);
+    EXPECT_EQ(result.values[1], 0xfedcba9876543210ULL);
+    EXPECT_EQ(result.values[2], 0);
+    EXPECT_EQ(result.values[3], uint256_max);
+    EXPECT_TRUE(result.malformed.empty());
+    std::remove(path.c_str());
+}
+
+TEST(Load, malformed){
+    write_file("1\n\n3\nfour\n5 \n115792089237316195423570985008687907853269984665640564039457584007913129639936\n7\n");
+
+    for(unsigned int threads = 1; threads < 4; threads++){
+        const uint256_load_result result = load_uint256_file(path, 10, threads);
+        ASSERT_EQ(result.values.size(), 7);
+        EXPECT_EQ(result.values[0], 1);
+        EXPECT_EQ(result.values[1], 0);
+        EXPECT_EQ(result.values[2], 3);
+        EXPECT_EQ(result.values[3], 0);
+        EXPECT_EQ(result.values[6], 7);
+        EXPECT_EQ(result.malformed, std::vector <std::size_t> ({2, 4, 5, 6}));
+    }
+    std::remove(path.c_str());
+}
+
+TEST(Load, empty){
+    write_file("");
+    for(unsigned int threads = 0; threads < 4; threads++){
+        const uint256_load_result result = load_uint256_file(path, 10, threads);
+        EXPECT_TRUE(result.values.empty());
+        EXPECT_TRUE(result.malformed.empty());
+    }
+    std::remove(path.c_str());
+
+    EXPECT_THROW(load_uint256_file(path), std::runtime_error);
+}
@@ -17,6 +17,30 @@ TEST(Arithmetic, modulo){
     EXPECT_THROW(uint256_t(1) % uint256_t(0), std::domain_error);
 }
 
+TEST(Arithmetic, modulo_multi_limb){
+    const uint256_t a(0xfedcba9876543210ULL, 0xf0e1d2c3b4a59687ULL, 0x78695a4b3c2d1e0fULL, 0x0123456789abcdefULL);
+    const uint256_t b(0x0000000000000000ULL, 0x0000000000000001ULL, 0xfffffffffffffffeULL, 0x0000000000000003ULL);
+    EXPECT_EQ(a % b, uint256_t(0x0000000000000000ULL, 0x0000000000000001ULL, 0xe9dccfc2b5a89b8aULL, 0x1985715d4935210eULL));
+
+    // quotient digit estimate needs correcting
+    const uint256_t c(0x8000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x7fffffffffffffffULL);
+    const uint256_t d(0x0000000000000000ULL, 0x8000000000000000ULL, 0xffffffffffffffffULL, 0x0000000000000001ULL);
+    EXPECT_EQ(c % d, uint256_t(0x0000000000000000ULL, 0x0000000000000002ULL, 0xfffffffffffffffdULL, 0x8000000000000001ULL));
+
+    EXPECT_EQ(uint256_max % uint256_t(0x10ULL), 0xfULL);
+}
+
+TEST(Arithmetic, modulo_single_limb){
+    EXPECT_EQ(uint256_max % 10, 5);
+    EXPECT_EQ(uint256_max % 1000000000000000000ULL, 584007913129639935ULL);
+    EXPECT_EQ(uint256_max % 0xfffffffffffffffdULL, 80);
+
+    // negative divisors are sign extended to 256 bits
+    EXPECT_EQ(uint256_t(0x1234ULL) % -1, 0x1234ULL);
+
+    EXPECT_THROW(uint256_t(1) % 0, std::domain_error);
+}
+
 TEST(External, modulo){
     bool      t    = true;
     bool      f    = false;
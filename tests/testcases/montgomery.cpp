@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+static const uint256_t a(0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL);
+static const uint256_t b(0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL);
+
+TEST(Montgomery, secp256k1_p){
+    typedef montgomery_field <secp256k1_p> field;
+    const field x(a), y(b);
+
+    EXPECT_EQ(field::modulus(), uint256_t(0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xfffffffefffffc2fULL));
+    EXPECT_EQ(x.value(), a);
+    EXPECT_EQ(field::one().value(), 1);
+    EXPECT_EQ(field().value(), 0);
+
+    EXPECT_EQ((x * y).value(),   uint256_t(0x8c644419c8c50984ULL, 0xe1e06f7bc8ebdb3cULL, 0x375c9addc912acf3ULL, 0x8dfac0488d5f655dULL));
+    EXPECT_EQ(x.square().value(), uint256_t(0x9377533a571691dfULL, 0x3dfb27d856efc027ULL, 0xe87efc7656c8ee71ULL, 0x90bd993a3c120f76ULL));
+    EXPECT_EQ((x + y).value(),   uint256_t(0x00000001000003d0ULL));
+    EXPECT_EQ((y - x).value(),   uint256_t(0x02468acf13579bdeULL, 0x02468acf13579bdeULL, 0x02468acf13579bdeULL, 0x02468ace1357980eULL));
+    EXPECT_EQ((-x).value(),      uint256_t(0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456689abca1fULL));
+
+    EXPECT_EQ(x * y, y * x);
+    EXPECT_EQ(x * x, x.square());
+    EXPECT_EQ(x * field::one(), x);
+    EXPECT_EQ(x - x, field());
+    EXPECT_EQ(-field(), field());
+    EXPECT_EQ(x + (-x), field());
+
+    // values are reduced on the way in
+    EXPECT_EQ(field(field::modulus()), field());
+    EXPECT_EQ(field(field::modulus() + 5).value(), 5);
+}
+
+TEST(Montgomery, secp256k1_n){
+    typedef montgomery_field <secp256k1_n> field;
+    const field x(a), y(b);
+
+    EXPECT_EQ((x * y).value(),   uint256_t(0xa5393281d581eac3ULL, 0x8aa0b5b7a4603985ULL, 0x62c086099ee7fe57ULL, 0x00c013d19c7b1d99ULL));
+    EXPECT_EQ(x.square().value(), uint256_t(0x264d236379079004ULL, 0xaed079721c6f960fULL, 0x2b5269d506d4b9d2ULL, 0x6f8e54553afbfca3ULL));
+    EXPECT_EQ((x + y).value(),   uint256_t(0x0000000000000000ULL, 0x0000000000000001ULL, 0x4551231950b75fc4ULL, 0x402da1732fc9bebeULL));
+    EXPECT_EQ((y - x).value(),   uint256_t(0x02468acf13579bdeULL, 0x02468acf13579bdcULL, 0xbcf567b5c2a03c19ULL, 0xc218e95be38ddd20ULL));
+    EXPECT_EQ((-x).value(),      uint256_t(0x0123456789abcdefULL, 0x0123456789abcdedULL, 0xbbd2224e38f46e2aULL, 0xc0f5a3f459e20f31ULL));
+}
+
+TEST(Montgomery, compound){
+    // 2^255 - 19
+    typedef montgomery_field <uint256_modulus <0x7fffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffedULL> > field;
+    field x(a);
+    x *= field(b);
+    EXPECT_EQ(x.value(), uint256_t(0x374c6c5b5db7ad57ULL, 0xd322db4097232896ULL, 0xeef94a25d08ea3d6ULL, 0x0acfb90b09fa1f13ULL));
+
+    field y = x;
+    y += field(b);
+    y -= field(b);
+    EXPECT_EQ(y, x);
+
+    // small modulus
+    typedef montgomery_field <uint256_modulus <0, 0, 0, 1000003> > small;
+    small s(uint256_t(999999));
+    EXPECT_EQ((s * s).value(), (999999ULL * 999999ULL) % 1000003);
+    EXPECT_EQ((s + s).value(), (2 * 999999ULL) % 1000003);
+    EXPECT_EQ((small() - s).value(), 1000003 - 999999);
+}
@@ -16,6 +16,59 @@ TEST(Arithmetic, multiply){
     EXPECT_EQ(one * val, val);
 }
 
+TEST(Arithmetic, multiply_wide){
+    // every column of partial products carries into the next one
+    const uint256_t max(0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL);
+    EXPECT_EQ(max * max, 1);
+    EXPECT_EQ(max * 2, max - 1);
+
+    const uint256_t a(0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL);
+    const uint256_t b(0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL);
+    EXPECT_EQ(a * b, uint256_t(0x8c4150419dedb986ULL, 0x68e87db10b145554ULL, 0x458fab20783af122ULL, 0x2236d88fe5618cf0ULL));
+    EXPECT_EQ(b * a, a * b);
+    EXPECT_EQ(a * a, uint256_t(0x74e1f525ebbe1468ULL, 0x983ac7b67e97789aULL, 0xbb939a471170dcccULL, 0xdeec6cd7a44a4100ULL));
+}
+
+TEST(Arithmetic, multiply_full){
+    const uint256_t max(0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL);
+    const std::pair <uint256_t, uint256_t> square = mul_wide(max, max);
+    EXPECT_EQ(square.first,  max - 1);
+    EXPECT_EQ(square.second, 1);
+    EXPECT_EQ(mulhi(max, max), max - 1);
+
+    const uint256_t a(0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL);
+    const uint256_t b(0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL);
+    const uint256_t hi(0x0121fa00ad77d742ULL, 0x247acc9140513b74ULL, 0x47d39f21d32a9fa6ULL, 0x6b2c71b2660403d8ULL);
+    const std::pair <uint256_t, uint256_t> product = mul_wide(a, b);
+    EXPECT_EQ(product.first,  hi);
+    EXPECT_EQ(product.second, a * b);
+    EXPECT_EQ(mulhi(a, b), hi);
+    EXPECT_EQ(mulhi(b, a), hi);
+
+    // products below 2^256 have no upper half
+    EXPECT_EQ(mul_wide(uint256_t(0xffffffffffffffffULL), uint256_t(0xffffffffffffffffULL)).first, 0);
+    EXPECT_EQ(mulhi(uint256_t(1, 0), uint256_t(1, 0)), 1);
+    EXPECT_EQ(mulhi(a, 0), 0);
+}
+
+TEST(External, multiply_limb){
+    // 64 bit operands carry through every limb
+    const uint256_t max(0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL);
+    EXPECT_EQ(max * (uint64_t) 0xffffffffffffffffULL, uint256_t(0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 1));
+    EXPECT_EQ(uint256_t(0, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL) * 2u, uint256_t(1, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xfffffffffffffffeULL));
+    EXPECT_EQ(uint256_t(0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL) * (uint64_t) 0x0123456789abcdefULL,
+              uint256_t(0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL) * uint256_t(0x0123456789abcdefULL));
+    EXPECT_EQ(max * (uint64_t) 0, 0);
+
+    // negative operands are sign extended to 256 bits
+    EXPECT_EQ(uint256_t(3) * -2, max - 5);
+    EXPECT_EQ(max * (int8_t) -1, 1);
+
+    uint256_t val(7);
+    EXPECT_EQ(val *= -1, max - 6);
+    EXPECT_EQ(val *= 3u, max - 20);
+}
+
 TEST(External, multiply){
     bool      t    = true;
     bool      f    = false;
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+TEST(Overflow, add){
+    uint256_t result;
+    EXPECT_FALSE(add_overflow(uint256_t(1), uint256_t(2), result));
+    EXPECT_EQ(result, 3);
+    EXPECT_FALSE(add_overflow(uint256_max - 1, uint256_1, result));
+    EXPECT_EQ(result, uint256_max);
+    EXPECT_TRUE(add_overflow(uint256_max, uint256_1, result));
+    EXPECT_EQ(result, 0);
+    EXPECT_TRUE(add_overflow(uint256_max, uint256_max, result));
+    EXPECT_EQ(result, uint256_max - 1);
+
+    // the carry crosses every limb
+    EXPECT_FALSE(add_overflow(uint256_t(0, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL), uint256_1, result));
+    EXPECT_EQ(result, uint256_t(1, 0, 0, 0));
+
+    // result may be an operand
+    uint256_t value = uint256_max;
+    EXPECT_TRUE(add_overflow(value, value, value));
+    EXPECT_EQ(value, uint256_max - 1);
+
+    EXPECT_EQ(add_sat(uint256_t(1), uint256_t(2)), 3);
+    EXPECT_EQ(add_sat(uint256_max, uint256_1), uint256_max);
+    EXPECT_EQ(add_sat(uint256_max - 5, uint256_t(5)), uint256_max);
+}
+
+TEST(Overflow, sub){
+    uint256_t result;
+    EXPECT_FALSE(sub_overflow(uint256_t(3), uint256_t(2), result));
+    EXPECT_EQ(result, 1);
+    EXPECT_FALSE(sub_overflow(uint256_t(3), uint256_t(3), result));
+    EXPECT_EQ(result, 0);
+    EXPECT_TRUE(sub_overflow(uint256_0, uint256_1, result));
+    EXPECT_EQ(result, uint256_max);
+    EXPECT_TRUE(sub_overflow(uint256_t(0, 0, 1, 0), uint256_t(1, 0, 0, 0), result));
+    EXPECT_EQ(result, uint256_t(0xffffffffffffffffULL, 0, 1, 0));
+
+    EXPECT_EQ(sub_sat(uint256_t(3), uint256_t(2)), 1);
+    EXPECT_EQ(sub_sat(uint256_t(2), uint256_t(3)), 0);
+    EXPECT_EQ(sub_sat(uint256_0, uint256_max), 0);
+}
+
+TEST(Overflow, mul){
+    uint256_t result;
+    EXPECT_FALSE(mul_overflow(uint256_t(6), uint256_t(7), result));
+    EXPECT_EQ(result, 42);
+    EXPECT_FALSE(mul_overflow(uint256_max, uint256_0, result));
+    EXPECT_EQ(result, 0);
+    EXPECT_FALSE(mul_overflow(uint256_max, uint256_1, result));
+    EXPECT_EQ(result, uint256_max);
+    EXPECT_TRUE(mul_overflow(uint256_max, uint256_t(2), result));
+    EXPECT_EQ(result, uint256_max - 1);
+
+    // bit widths that add up to 257 may or may not overflow
+    const uint256_t half = uint256_1 << 128;
+    EXPECT_FALSE(mul_overflow(half - 1, half, result));                 // 128 + 129 bits
+    EXPECT_EQ(result, uint256_max - (half - 1));
+    EXPECT_TRUE(mul_overflow(half + 1, half, result));                  // 129 + 129 bits
+    EXPECT_EQ(result, half);
+    EXPECT_FALSE(mul_overflow(half - 1, half + 1, result));             // (2^128 - 1)(2^128 + 1) = 2^256 - 1
+    EXPECT_EQ(result, uint256_max);
+    EXPECT_TRUE(mul_overflow(half + 1, half + 1, result));
+    EXPECT_EQ(result, (half << 1) + 1);
+    EXPECT_TRUE(mul_overflow(uint256_1 << 255, uint256_t(3), result));  // 256 + 2 bits
+    EXPECT_EQ(result, uint256_1 << 255);
+
+    // agrees with mul_wide
+    for(int i = 0; i < 256; i += 5){
+        for(int j = 0; j < 256; j += 7){
+            const uint256_t lhs = (uint256_max >> i) - j;
+            const uint256_t rhs = (uint256_max >> (255 - j)) + i;
+            const std::pair <uint256_t, uint256_t> wide = mul_wide(lhs, rhs);
+            EXPECT_EQ(mul_overflow(lhs, rhs, result), wide.first != 0);
+            EXPECT_EQ(result, wide.second);
+        }
+    }
+
+    EXPECT_EQ(mul_sat(uint256_t(6), uint256_t(7)), 42);
+    EXPECT_EQ(mul_sat(half, half), uint256_max);
+    EXPECT_EQ(mul_sat(half - 1, half + 1), uint256_max);
+    EXPECT_EQ(mul_sat(half, half - 1), uint256_max - (half - 1));
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include "uint256_t.h"
+
+static const uint256_t a(0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL, 0xfedcba9876543210ULL);
+static const uint256_t b(0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL, 0x0123456789abcdefULL);
+
+TEST(Powmod, odd){
+    const uint256_t p = montgomery_field <secp256k1_p>::modulus();
+    EXPECT_EQ(powmod(a, b, p), uint256_t(0xaf23c5acceeb037aULL, 0xd5e9829443f81a1cULL, 0xa1c5561b306a4e57ULL, 0x0e074050947e2f30ULL));
+    EXPECT_EQ(powmod(a, b, uint256_t(0x7fffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffedULL)),
+              uint256_t(0x1fcc7de9452f2b98ULL, 0x79118cb28b7055bfULL, 0x8f0a8d9895ae1db3ULL, 0x74fff5a5abd78212ULL));
+    EXPECT_EQ(powmod(a, 65537, uint256_max), uint256_t(0xa68597acceab54fcULL, 0xa68597acceab54fcULL, 0xa68597acceab54fcULL, 0xa68597acceab54fcULL));
+
+    // Fermat's little theorem
+    EXPECT_EQ(powmod(a, p - 1, p), 1);
+    const barrett_context ctx(p);
+    EXPECT_EQ(ctx.mulmod(powmod(a, p - 2, p), a), 1);
+}
+
+TEST(Powmod, even){
+    EXPECT_EQ(powmod(3, 1000, uint256_t(1) << 64), 0x5616937bd3b85b21ULL);
+    EXPECT_EQ(powmod(a, b, uint256_max - 1), uint256_t(0x325e5a512d6014e5ULL, 0x105f3088bde1b958ULL, 0xbe6995643905d311ULL, 0xe39215a77855d1ecULL));
+}
+
+TEST(Powmod, windows){
+    // every window width against repeated multiplication
+    const uint256_t moduli[] = {montgomery_field <secp256k1_n>::modulus(), uint256_t(1) << 200};
+    for(uint256_t const & m : moduli){
+        const barrett_context ctx(m);
+        uint256_t expected = 1;
+        for(unsigned int e = 0; e < 300; e++){
+            EXPECT_EQ(powmod(b, e, m), expected);
+            expected = ctx.mulmod(expected, b);
+        }
+
+        // x^(2e + 1) = (x^e)^2 * x for exponents of every size
+        for(unsigned int shift = 1; shift < 256; shift += 7){
+            const uint256_t e = a >> shift;
+            const uint256_t half = powmod(b, e, m);
+            EXPECT_EQ(powmod(b, e * 2 + 1, m), ctx.mulmod(ctx.mulmod(half, half), b));
+        }
+    }
+}
+
+TEST(Powmod, edge){
+    EXPECT_EQ(powmod(a, 0, 7), 1);
+    EXPECT_EQ(powmod(a, 0, 1), 0);
+    EXPECT_EQ(powmod(a, b, 1), 0);
+    EXPECT_EQ(powmod(0, b, 7), 0);
+    EXPECT_EQ(powmod(uint256_max, 2, 10), 5);
+    EXPECT_EQ(powmod(uint256_max, 2, 11), (uint256_max % 11) * (uint256_max % 11) % 11);
+    EXPECT_THROW(powmod(a, b, 0), std::domain_error);
+}
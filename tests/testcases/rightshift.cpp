@@ -25,6 +25,40 @@ TEST(BitShift, right){
     }
 }
 
+TEST(BitShift, right_count){
+    const uint256_t val(0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL);
+
+    EXPECT_EQ(val >> 0u,   val);
+    EXPECT_EQ(val >> 1u,   uint256_t(0x0091a2b3c4d5e6f7ULL, 0xff6e5d4c3b2a1908ULL, 0x078f169e25ad34bcULL, 0x43cb52da61e970f8ULL));
+    EXPECT_EQ(val >> 63u,  uint256_t(0x0000000000000000ULL, 0x02468acf13579bdfULL, 0xfdb97530eca86420ULL, 0x1e3c5a7896b4d2f1ULL));
+    EXPECT_EQ(val >> 64u,  uint256_t(0x0000000000000000ULL, 0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x0f1e2d3c4b5a6978ULL));
+    EXPECT_EQ(val >> 100u, uint256_t(0x0000000000000000ULL, 0x0000000000123456ULL, 0x789abcdeffedcba9ULL, 0x8765432100f1e2d3ULL));
+    EXPECT_EQ(val >> 191u, uint256_t(0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x02468acf13579bdfULL));
+    EXPECT_EQ(val >> 256u, 0);
+    EXPECT_EQ(val >> 1000u, 0);
+
+    // every count type gives the same result
+    for(int i = 0; i < 300; i++){
+        const uint256_t expected = val >> (unsigned int) i;
+        EXPECT_EQ(val >> i, expected);
+        EXPECT_EQ(val >> (uint64_t) i, expected);
+        EXPECT_EQ(val >> (uint16_t) i, expected);
+        EXPECT_EQ(val >> uint128_t(i), expected);
+        EXPECT_EQ(val >> uint256_t(i), expected);
+        if (i){
+            EXPECT_EQ((val >> (unsigned int) (i - 1)) >> 1u, expected);
+        }
+
+        uint256_t shifted = val;
+        EXPECT_EQ(shifted >>= (unsigned int) i, expected);
+    }
+
+    // negative counts shift everything out
+    EXPECT_EQ(val >> -1, 0);
+    EXPECT_EQ(val >> (int8_t) -128, 0);
+    EXPECT_EQ(val >> uint256_t(1, 0), 0);
+}
+
 TEST(External, shift_right){
     bool     t   = true;
     bool     f   = false;
@@ -38,4 +38,31 @@ TEST(External, subtract){
     EXPECT_EQ(u32  -= val, (uint32_t) 0xb9b9b9baULL);
     EXPECT_EQ(u64  -= val, (uint64_t) 0xb9b9b9b9b9b9b9baULL);
     EXPECT_EQ(u128 -= val,  uint128_t(0xb9b9b9b9b9b9b9b9ULL, 0xb9b9b9b9b9b9b9baULL));
-}
\ No newline at end of file
+}
+
+TEST(Arithmetic, subtract_borrow){
+    // borrows ripple through every limb
+    EXPECT_EQ(uint256_t(0, 0, 1, 0) - 1, uint256_t(0, 0, 0, 0xffffffffffffffffULL));
+    EXPECT_EQ(uint256_t(0, 1, 0, 0) - 1, uint256_t(0, 0, 0xffffffffffffffffULL, 0xffffffffffffffffULL));
+    EXPECT_EQ(uint256_t(1, 0, 0, 0) - 1, uint256_t(0, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL));
+    EXPECT_EQ(uint256_t(0) - 1, uint256_t(0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL));
+
+    uint256_t value(1, 0, 0, 0);
+    EXPECT_EQ(--value, uint256_t(0, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL));
+    EXPECT_EQ(value -= uint256_t(0, 0xffffffffffffffffULL, 0, 1), uint256_t(0, 0, 0xffffffffffffffffULL, 0xfffffffffffffffeULL));
+    EXPECT_EQ(-uint256_t(0, 0, 1, 0), uint256_t(0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0));
+}
+
+TEST(External, subtract_signed){
+    const uint256_t max(0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL);
+    EXPECT_EQ(uint256_t(0, 1, 0, 0) - (uint64_t) 0xffffffffffffffffULL, uint256_t(0, 0, 0xffffffffffffffffULL, 1));
+
+    // negative operands are sign extended to 256 bits
+    EXPECT_EQ(uint256_t(5) - -1, 6);
+    EXPECT_EQ(uint256_t(0, 0, 0, 0xffffffffffffffffULL) - (int8_t) -1, uint256_t(0, 0, 1, 0));
+    EXPECT_EQ(max - (int8_t) -2, 1);
+
+    uint256_t value(5);
+    EXPECT_EQ(value -= 6u, max);
+    EXPECT_EQ(value -= -2, 1);
+}
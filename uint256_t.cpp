@@ -1,374 +1,1582 @@
+#ifndef _UINT256_T_CPP_
+#define _UINT256_T_CPP_
+
+// header only builds get here from uint256_t.h
+#ifdef UINT256_T_HEADER_ONLY
+#include "uint256_t.h"
+#else
 #include "uint256_t.build"
+#endif
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <thread>
 #include <vector>
 #include <cstring>
 
-const uint128_t uint128_64(64);
-const uint128_t uint128_128(128);
-const uint128_t uint128_256(256);
-const uint256_t uint256_0(0);
-const uint256_t uint256_1(1);
-const uint256_t uint256_max(uint128_t((uint64_t) -1, (uint64_t) -1), uint128_t((uint64_t) -1, (uint64_t) -1));
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#endif
+
+// mulx and the adcx/adox carry chains (BMI2 and ADX)
+#if defined(__x86_64__) && defined(__BMI2__) && defined(__ADX__) && (defined(__GNUC__) || defined(__clang__))
+#define UINT256_T_HAS_MULX
+#endif
+
+// vector kernels for the batch operations load values straight from memory,
+// so they need the limbs in little endian order
+#if defined(UINT256_T_LIMBS) && !defined(__BIG_ENDIAN__) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#if defined(__AVX512F__)
+#define UINT256_T_HAS_AVX512
+#elif defined(__AVX2__)
+#define UINT256_T_HAS_AVX2
+#endif
+#endif
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_addcll) && __has_builtin(__builtin_subcll)
+#define UINT256_T_HAS_ADDC
+#endif
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define UINT256_T_HAS_MMAP
+#endif
+
+// Helpers live in uint256_t_detail. Header only, the inline members that
+// call them are defined in every translation unit, so the helpers must be
+// the same entities everywhere and cannot be in an unnamed namespace.
+// Otherwise they stay internal to the library.
+#ifdef UINT256_T_HEADER_ONLY
+#define UINT256_T_DETAIL_BEGIN namespace uint256_t_detail{
+#define UINT256_T_DETAIL_END }
+#else
+#define UINT256_T_DETAIL_BEGIN namespace uint256_t_detail{ namespace{
+#define UINT256_T_DETAIL_END }}
+#endif
+
+UINT256_T_INLINE_VAR const uint128_t uint128_64(64);
+UINT256_T_INLINE_VAR const uint128_t uint128_128(128);
+UINT256_T_INLINE_VAR const uint128_t uint128_256(256);
+#if !(defined(UINT256_T_LIMBS) && (__cplusplus >= 201703L))
+UINT256_T_INLINE_VAR const uint256_t uint256_0(0);
+UINT256_T_INLINE_VAR const uint256_t uint256_1(1);
+UINT256_T_INLINE_VAR const uint256_t uint256_max((uint64_t) -1, (uint64_t) -1, (uint64_t) -1, (uint64_t) -1);
+#endif
+
+// 64 bit limb helpers
+// limbs are stored least significant first
+UINT256_T_DETAIL_BEGIN
+    UINT256_T_INLINE void to_limbs(const uint256_t & value, uint64_t limbs[4]){
+#ifdef UINT256_T_LIMBS
+        // the value is already stored as limbs in memory order
+        // copying them one at a time keeps them out of vector registers
+        const char * bytes = reinterpret_cast <const char *> (&value);
+#ifdef __BIG_ENDIAN__
+        std::memcpy(&limbs[3], bytes,      8);
+        std::memcpy(&limbs[2], bytes + 8,  8);
+        std::memcpy(&limbs[1], bytes + 16, 8);
+        std::memcpy(&limbs[0], bytes + 24, 8);
+#else
+        std::memcpy(&limbs[0], bytes,      8);
+        std::memcpy(&limbs[1], bytes + 8,  8);
+        std::memcpy(&limbs[2], bytes + 16, 8);
+        std::memcpy(&limbs[3], bytes + 24, 8);
+#endif
+#else
+        limbs[0] = value.lower().lower();
+        limbs[1] = value.lower().upper();
+        limbs[2] = value.upper().lower();
+        limbs[3] = value.upper().upper();
+#endif
+    }
+
+    UINT256_T_INLINE uint256_t from_limbs(const uint64_t limbs[4]){
+        return uint256_t(limbs[3], limbs[2], limbs[1], limbs[0]);
+    }
+
+    // x <<= shift and x >>= shift, for shift < 256
+    // whole limbs move first, then the bits within them
+    UINT256_T_INLINE void shl256(uint64_t & x0, uint64_t & x1, uint64_t & x2, uint64_t & x3, const unsigned int shift){
+        if (shift & 128){
+            x3 = x1;
+            x2 = x0;
+            x1 = 0;
+            x0 = 0;
+        }
+        if (shift & 64){
+            x3 = x2;
+            x2 = x1;
+            x1 = x0;
+            x0 = 0;
+        }
+        const unsigned int bits = shift & 63;
+        if (bits){
+            x3 = (x3 << bits) | (x2 >> (64 - bits));
+            x2 = (x2 << bits) | (x1 >> (64 - bits));
+            x1 = (x1 << bits) | (x0 >> (64 - bits));
+            x0 <<= bits;
+        }
+    }
+
+    UINT256_T_INLINE void shr256(uint64_t & x0, uint64_t & x1, uint64_t & x2, uint64_t & x3, const unsigned int shift){
+        if (shift & 128){
+            x0 = x2;
+            x1 = x3;
+            x2 = 0;
+            x3 = 0;
+        }
+        if (shift & 64){
+            x0 = x1;
+            x1 = x2;
+            x2 = x3;
+            x3 = 0;
+        }
+        const unsigned int bits = shift & 63;
+        if (bits){
+            x0 = (x0 >> bits) | (x1 << (64 - bits));
+            x1 = (x1 >> bits) | (x2 << (64 - bits));
+            x2 = (x2 >> bits) | (x3 << (64 - bits));
+            x3 >>= bits;
+        }
+    }
+
+    // number of leading zero bits of a nonzero value
+    UINT256_T_INLINE unsigned int clz64(uint64_t x){
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_clzll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanReverse64(&index, x);
+        return 63 - index;
+#else
+        unsigned int n = 0;
+        while (!(x & 0x8000000000000000ULL)){
+            x <<= 1;
+            n++;
+        }
+        return n;
+#endif
+    }
+
+    // number of trailing zero bits of a nonzero value
+    UINT256_T_INLINE unsigned int ctz64(uint64_t x){
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, x);
+        return index;
+#else
+        unsigned int n = 0;
+        while (!(x & 1)){
+            x >>= 1;
+            n++;
+        }
+        return n;
+#endif
+    }
+
+#ifndef UINT256_T_LIMBS
+    // -1, 0 or 1 as a is less than, equal to or greater than b
+    UINT256_T_INLINE int cmp64(const uint64_t a, const uint64_t b){
+        return (int) (a > b) - (int) (a < b);
+    }
+#endif
+
+    // number of set bits
+    // without popcnt, GCC calls a table lookup in libgcc that is slower than the bit tricks
+    UINT256_T_INLINE unsigned int popcount64(uint64_t x){
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__POPCNT__) || !(defined(__x86_64__) || defined(__i386__)))
+        return __builtin_popcountll(x);
+#else
+        x = x - ((x >> 1) & 0x5555555555555555ULL);
+        x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+        x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+        return (unsigned int) ((x * 0x0101010101010101ULL) >> 56);
+#endif
+    }
+
+    // 64 x 64 -> 128 bit multiplication; returns the lower half
+    UINT256_T_INLINE uint64_t mul64(const uint64_t a, const uint64_t b, uint64_t & hi){
+#if defined(__SIZEOF_INT128__)
+        __extension__ typedef unsigned __int128 dword;
+        const dword p = (dword) a * b;
+        hi = (uint64_t) (p >> 64);
+        return (uint64_t) p;
+#elif defined(_MSC_VER) && defined(_M_X64)
+        return _umul128(a, b, &hi);
+#else
+        const uint64_t a_lo = a & 0xffffffffULL, a_hi = a >> 32;
+        const uint64_t b_lo = b & 0xffffffffULL, b_hi = b >> 32;
+        const uint64_t ll = a_lo * b_lo;
+        const uint64_t lh = a_lo * b_hi;
+        const uint64_t hl = a_hi * b_lo;
+        const uint64_t mid = (ll >> 32) + (lh & 0xffffffffULL) + (hl & 0xffffffffULL);
+        hi = a_hi * b_hi + (lh >> 32) + (hl >> 32) + (mid >> 32);
+        return (mid << 32) | (ll & 0xffffffffULL);
+#endif
+    }
+
+    // t += a * b + carry; returns the high limb
+    UINT256_T_INLINE uint64_t mac64(uint64_t & t, const uint64_t a, const uint64_t b, const uint64_t carry){
+        uint64_t hi;
+        uint64_t lo = mul64(a, b, hi);
+        lo += carry;
+        hi += (lo < carry);
+        t += lo;
+        return hi + (t < lo);
+    }
+
+    // (c2, c1, c0) += a * b
+    UINT256_T_INLINE void mul_acc(const uint64_t a, const uint64_t b, uint64_t & c0, uint64_t & c1, uint64_t & c2){
+        uint64_t hi;
+        const uint64_t lo = mul64(a, b, hi);
+        c0 += lo;
+        hi += (c0 < lo);    // the upper half of a product is at most 2^64 - 2
+        c1 += hi;
+        c2 += (c1 < hi);
+    }
+
+    // r = a * b mod 2^256
+    // Only the 10 partial products below 2^256 are needed, and the 4 in the
+    // top column only contribute their lower halves
+    UINT256_T_INLINE void mul_limbs(const uint64_t a[4], const uint64_t b[4], uint64_t r[4]){
+#ifdef UINT256_T_HAS_MULX
+        // Scan the rows of a instead of the columns so that the lower halves
+        // of each row are added on the CF chain (adcx) while the upper halves
+        // are added on the OF chain (adox); mulx leaves both flags alone
+        uint64_t r0, r1, r2, r3, lo, hi;
+        __asm__(
+            "movq    (%[a]), %%rdx\n\t"
+            "mulxq   (%[b]), %[r0], %[r1]\n\t"
+            "mulxq  8(%[b]), %[lo], %[r2]\n\t"
+            "addq    %[lo], %[r1]\n\t"
+            "mulxq 16(%[b]), %[lo], %[r3]\n\t"
+            "adcq    %[lo], %[r2]\n\t"
+            "mulxq 24(%[b]), %[lo], %[hi]\n\t"
+            "adcq    %[lo], %[r3]\n\t"
+
+            "movq   8(%[a]), %%rdx\n\t"
+            "xorl    %k[lo], %k[lo]\n\t"
+            "mulxq   (%[b]), %[lo], %[hi]\n\t"
+            "adcxq   %[lo], %[r1]\n\t"
+            "adoxq   %[hi], %[r2]\n\t"
+            "mulxq  8(%[b]), %[lo], %[hi]\n\t"
+            "adcxq   %[lo], %[r2]\n\t"
+            "adoxq   %[hi], %[r3]\n\t"
+            "mulxq 16(%[b]), %[lo], %[hi]\n\t"
+            "adcxq   %[lo], %[r3]\n\t"
+
+            "movq  16(%[a]), %%rdx\n\t"
+            "xorl    %k[lo], %k[lo]\n\t"
+            "mulxq   (%[b]), %[lo], %[hi]\n\t"
+            "adcxq   %[lo], %[r2]\n\t"
+            "adoxq   %[hi], %[r3]\n\t"
+            "mulxq  8(%[b]), %[lo], %[hi]\n\t"
+            "adcxq   %[lo], %[r3]\n\t"
+
+            "movq  24(%[a]), %%rdx\n\t"
+            "mulxq   (%[b]), %[lo], %[hi]\n\t"
+            "addq    %[lo], %[r3]\n\t"
+            : [r0] "=&r"(r0), [r1] "=&r"(r1), [r2] "=&r"(r2), [r3] "=&r"(r3), [lo] "=&r"(lo), [hi] "=&r"(hi)
+            : [a] "r"(a), [b] "r"(b), "m"(*(const uint64_t (*)[4]) a), "m"(*(const uint64_t (*)[4]) b)
+            : "rdx", "cc");
+        r[0] = r0;
+        r[1] = r1;
+        r[2] = r2;
+        r[3] = r3;
+#else
+        // product scanning (Comba): sum each column of partial products
+        // into a three limb accumulator, then shift it down one limb
+        uint64_t c0, c1, c2 = 0;
+        r[0] = mul64(a[0], b[0], c0);
+
+        c1 = 0;
+        mul_acc(a[0], b[1], c0, c1, c2);
+        mul_acc(a[1], b[0], c0, c1, c2);
+        r[1] = c0;
+
+        c0 = c1;
+        c1 = c2;
+        c2 = 0;
+        mul_acc(a[0], b[2], c0, c1, c2);
+        mul_acc(a[1], b[1], c0, c1, c2);
+        mul_acc(a[2], b[0], c0, c1, c2);
+        r[2] = c0;
+
+        r[3] = c1 + a[0] * b[3] + a[1] * b[2] + a[2] * b[1] + a[3] * b[0];
+#endif
+    }
+
+    // r = a * b, all 512 bits
+    // Same structure as mul_limbs, but every partial product is kept
+    UINT256_T_INLINE void mul_limbs_wide(const uint64_t a[4], const uint64_t b[4], uint64_t r[8]){
+#ifdef UINT256_T_HAS_MULX
+        // Rows are accumulated into a window of five limbs; the lowest one
+        // is final after each row and is stored before its register is
+        // reused for the new top limb. The result is only written through
+        // r, so the asm has to be volatile to be kept.
+        uint64_t x0, x1, x2, x3, x4, lo, hi, zero;
+        __asm__ __volatile__(
+            "movq    (%[a]), %%rdx\n\t"
+            "mulxq   (%[b]), %[x0], %[x1]\n\t"
+            "mulxq  8(%[b]), %[lo], %[x2]\n\t"
+            "addq    %[lo], %[x1]\n\t"
+            "mulxq 16(%[b]), %[lo], %[x3]\n\t"
+            "adcq    %[lo], %[x2]\n\t"
+            "mulxq 24(%[b]), %[lo], %[x4]\n\t"
+            "adcq    %[lo], %[x3]\n\t"
+            "adcq    $0, %[x4]\n\t"
+            "movq    %[x0], (%[r])\n\t"
+
+            "movq   8(%[a]), %%rdx\n\t"
+            "xorl    %k[zero], %k[zero]\n\t"
+            "mulxq   (%[b]), %[lo], %[hi]\n\t"
+            "adcxq   %[lo], %[x1]\n\t"
+            "adoxq   %[hi], %[x2]\n\t"
+            "mulxq  8(%[b]), %[lo], %[hi]\n\t"
+            "adcxq   %[lo], %[x2]\n\t"
+            "adoxq   %[hi], %[x3]\n\t"
+            "mulxq 16(%[b]), %[lo], %[hi]\n\t"
+            "adcxq   %[lo], %[x3]\n\t"
+            "adoxq   %[hi], %[x4]\n\t"
+            "mulxq 24(%[b]), %[lo], %[x0]\n\t"
+            "adcxq   %[lo], %[x4]\n\t"
+            "adoxq   %[zero], %[x0]\n\t"
+            "adcxq   %[zero], %[x0]\n\t"
+            "movq    %[x1], 8(%[r])\n\t"
+
+            "movq  16(%[a]), %%rdx\n\t"
+            "xorl    %k[zero], %k[zero]\n\t"
+            "mulxq   (%[b]), %[lo], %[hi]\n\t"
+            "adcxq   %[lo], %[x2]\n\t"
+            "adoxq   %[hi], %[x3]\n\t"
+            "mulxq  8(%[b]), %[lo], %[hi]\n\t"
+            "adcxq   %[lo], %[x3]\n\t"
+            "adoxq   %[hi], %[x4]\n\t"
+            "mulxq 16(%[b]), %[lo], %[hi]\n\t"
+            "adcxq   %[lo], %[x4]\n\t"
+            "adoxq   %[hi], %[x0]\n\t"
+            "mulxq 24(%[b]), %[lo], %[x1]\n\t"
+            "adcxq   %[lo], %[x0]\n\t"
+            "adoxq   %[zero], %[x1]\n\t"
+            "adcxq   %[zero], %[x1]\n\t"
+            "movq    %[x2], 16(%[r])\n\t"
+
+            "movq  24(%[a]), %%rdx\n\t"
+            "xorl    %k[zero], %k[zero]\n\t"
+            "mulxq   (%[b]), %[lo], %[hi]\n\t"
+            "adcxq   %[lo], %[x3]\n\t"
+            "adoxq   %[hi], %[x4]\n\t"
+            "mulxq  8(%[b]), %[lo], %[hi]\n\t"
+            "adcxq   %[lo], %[x4]\n\t"
+            "adoxq   %[hi], %[x0]\n\t"
+            "mulxq 16(%[b]), %[lo], %[hi]\n\t"
+            "adcxq   %[lo], %[x0]\n\t"
+            "adoxq   %[hi], %[x1]\n\t"
+            "mulxq 24(%[b]), %[lo], %[x2]\n\t"
+            "adcxq   %[lo], %[x1]\n\t"
+            "adoxq   %[zero], %[x2]\n\t"
+            "adcxq   %[zero], %[x2]\n\t"
+            "movq    %[x3], 24(%[r])\n\t"
+            "movq    %[x4], 32(%[r])\n\t"
+            "movq    %[x0], 40(%[r])\n\t"
+            "movq    %[x1], 48(%[r])\n\t"
+            "movq    %[x2], 56(%[r])\n\t"
+            : [x0] "=&r"(x0), [x1] "=&r"(x1), [x2] "=&r"(x2), [x3] "=&r"(x3), [x4] "=&r"(x4),
+              [lo] "=&r"(lo), [hi] "=&r"(hi), [zero] "=&r"(zero)
+            : [a] "r"(a), [b] "r"(b), [r] "r"(r)
+            : "rdx", "cc", "memory");
+#else
+        uint64_t c0, c1 = 0, c2 = 0;
+        r[0] = mul64(a[0], b[0], c0);
+
+        mul_acc(a[0], b[1], c0, c1, c2);
+        mul_acc(a[1], b[0], c0, c1, c2);
+        r[1] = c0;
+        c0 = c1;
+        c1 = c2;
+        c2 = 0;
+
+        mul_acc(a[0], b[2], c0, c1, c2);
+        mul_acc(a[1], b[1], c0, c1, c2);
+        mul_acc(a[2], b[0], c0, c1, c2);
+        r[2] = c0;
+        c0 = c1;
+        c1 = c2;
+        c2 = 0;
+
+        mul_acc(a[0], b[3], c0, c1, c2);
+        mul_acc(a[1], b[2], c0, c1, c2);
+        mul_acc(a[2], b[1], c0, c1, c2);
+        mul_acc(a[3], b[0], c0, c1, c2);
+        r[3] = c0;
+        c0 = c1;
+        c1 = c2;
+        c2 = 0;
+
+        mul_acc(a[1], b[3], c0, c1, c2);
+        mul_acc(a[2], b[2], c0, c1, c2);
+        mul_acc(a[3], b[1], c0, c1, c2);
+        r[4] = c0;
+        c0 = c1;
+        c1 = c2;
+        c2 = 0;
+
+        mul_acc(a[2], b[3], c0, c1, c2);
+        mul_acc(a[3], b[2], c0, c1, c2);
+        r[5] = c0;
+        c0 = c1;
+        c1 = c2;
+        c2 = 0;
+
+        mul_acc(a[3], b[3], c0, c1, c2);
+        r[6] = c0;
+        r[7] = c1;
+#endif
+    }
+
+    // a + b + carry; carry is 0 or 1 and is replaced by the carry out
+    UINT256_T_INLINE uint64_t addc64(const uint64_t a, const uint64_t b, uint64_t & carry){
+#if defined(UINT256_T_HAS_ADDC)
+        unsigned long long out;
+        const uint64_t sum = __builtin_addcll(a, b, carry, &out);
+        carry = out;
+        return sum;
+#elif defined(__x86_64__) || defined(_M_X64)
+        unsigned long long sum;
+        carry = _addcarry_u64((unsigned char) carry, a, b, &sum);
+        return sum;
+#else
+        const uint64_t sum = a + b;
+        const uint64_t out = sum + carry;
+        carry = (sum < a) | (out < sum);
+        return out;
+#endif
+    }
+
+    // a - b - borrow; borrow is 0 or 1 and is replaced by the borrow out
+    UINT256_T_INLINE uint64_t subb64(const uint64_t a, const uint64_t b, uint64_t & borrow){
+#if defined(UINT256_T_HAS_ADDC)
+        unsigned long long out;
+        const uint64_t diff = __builtin_subcll(a, b, borrow, &out);
+        borrow = out;
+        return diff;
+#elif defined(__x86_64__) || defined(_M_X64)
+        unsigned long long diff;
+        borrow = _subborrow_u64((unsigned char) borrow, a, b, &diff);
+        return diff;
+#else
+        const uint64_t diff = a - b;
+        const uint64_t out = diff - borrow;
+        borrow = (a < b) | (diff < borrow);
+        return out;
+#endif
+    }
+
+    // r = a * a, all 512 bits
+    // Each product below the diagonal equals one above it, so they are
+    // summed once, doubled, and the squares on the diagonal added last
+    UINT256_T_INLINE void sqr_limbs_wide(const uint64_t a[4], uint64_t r[8]){
+        const uint64_t a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3];
+        uint64_t hi, c0, c1 = 0, c2 = 0;
+        r[0] = 0;
+        r[1] = mul64(a0, a1, c0);
+
+        mul_acc(a0, a2, c0, c1, c2);
+        r[2] = c0;
+        c0 = c1;
+        c1 = c2;
+        c2 = 0;
+
+        mul_acc(a0, a3, c0, c1, c2);
+        mul_acc(a1, a2, c0, c1, c2);
+        r[3] = c0;
+        c0 = c1;
+        c1 = c2;
+        c2 = 0;
+
+        mul_acc(a1, a3, c0, c1, c2);
+        r[4] = c0;
+        c0 = c1;
+        c1 = c2;
+        c2 = 0;
+
+        mul_acc(a2, a3, c0, c1, c2);
+        r[5] = c0;
+        r[6] = c1;
+
+        // the sum is below 2^511, so doubling it cannot overflow
+        r[7] = r[6] >> 63;
+        r[6] = (r[6] << 1) | (r[5] >> 63);
+        r[5] = (r[5] << 1) | (r[4] >> 63);
+        r[4] = (r[4] << 1) | (r[3] >> 63);
+        r[3] = (r[3] << 1) | (r[2] >> 63);
+        r[2] = (r[2] << 1) | (r[1] >> 63);
+        r[1] =  r[1] << 1;
+
+        uint64_t carry = 0;
+        uint64_t lo = mul64(a0, a0, hi);
+        r[0] = lo;
+        r[1] = addc64(r[1], hi, carry);
+        lo = mul64(a1, a1, hi);
+        r[2] = addc64(r[2], lo, carry);
+        r[3] = addc64(r[3], hi, carry);
+        lo = mul64(a2, a2, hi);
+        r[4] = addc64(r[4], lo, carry);
+        r[5] = addc64(r[5], hi, carry);
+        lo = mul64(a3, a3, hi);
+        r[6] = addc64(r[6], lo, carry);
+        r[7] = addc64(r[7], hi, carry);
+    }
+
+    // Montgomery reduction: r = t / 2^256 mod m for t < m * 2^256
+    // Each step adds the multiple of m that clears the lowest limb of the
+    // window, then slides the window up one limb; what is left is below 2m
+    UINT256_T_INLINE void montgomery_reduce(uint64_t r[4], const uint64_t t[8], const uint64_t m[4], const uint64_t ninv){
+        const uint64_t m0 = m[0], m1 = m[1], m2 = m[2], m3 = m[3];
+        uint64_t t0 = t[0], t1 = t[1], t2 = t[2], t3 = t[3];
+        uint64_t top = 0;   // carry into the limb above the window
+        for(int i = 4; i < 8; i++){
+            const uint64_t u = t0 * ninv;
+            uint64_t carry = mac64(t0, u, m0, 0);
+            carry          = mac64(t1, u, m1, carry);
+            carry          = mac64(t2, u, m2, carry);
+            carry          = mac64(t3, u, m3, carry);
+            t0 = t1;
+            t1 = t2;
+            t2 = t3;
+            t3 = addc64(t[i], carry, top);
+        }
+
+        // subtract m once unless that borrows past the carry bit
+        uint64_t borrow = 0;
+        const uint64_t d0 = subb64(t0, m0, borrow);
+        const uint64_t d1 = subb64(t1, m1, borrow);
+        const uint64_t d2 = subb64(t2, m2, borrow);
+        const uint64_t d3 = subb64(t3, m3, borrow);
+        const uint64_t keep = 0 - (uint64_t) (top >= borrow);
+        r[0] = (d0 & keep) | (t0 & ~keep);
+        r[1] = (d1 & keep) | (t1 & ~keep);
+        r[2] = (d2 & keep) | (t2 & ~keep);
+        r[3] = (d3 & keep) | (t3 & ~keep);
+    }
+
+    // Barrett reduction: r = x mod (m >> shift) for x < (m >> shift) * 2^256
+    // m is normalized and mu = floor((2^512 - 1) / m) - 2^256, so that the
+    // quotient of the 512 bit x << shift by m is estimated from the upper half
+    // of a 256 bit product, the same way div2by1 does it with 64 bit limbs.
+    // The estimate is at most 4 too small, and shifting x scales the
+    // remainder by 2^shift.
+    UINT256_T_INLINE void barrett_reduce(uint64_t r[4], const uint64_t x[8], const uint64_t m[4], const uint64_t mu[4], const unsigned int shift){
+        // whole limbs first, then the bits within them
+        // (y >> 1) >> (63 - bits) is y >> (64 - bits) without shifting by 64
+        const int words = shift / 64;
+        const unsigned int bits = shift % 64;
+        uint64_t t[9];
+        t[0] = 0;
+        for(int i = 0; i < 8; i++){
+            t[i + 1] = (i >= words)?x[i - words]:0;
+        }
+        for(int i = 8; i > 0; i--){
+            t[i] = (t[i] << bits) | ((t[i - 1] >> 1) >> (63 - bits));
+        }
+        const uint64_t * const u = t + 1;
+
+        // q = upper half of u + upper half of u * mu, which is less than 2^256
+        // The two lowest columns of u * mu are skipped; the carries they would
+        // have made are less than 2^193, so the estimate only loses 1 more
+        const uint64_t * const h = u + 4;
+        uint64_t c0 = 0, c1 = 0, c2 = 0;
+        mul_acc(h[0], mu[2], c0, c1, c2);
+        mul_acc(h[1], mu[1], c0, c1, c2);
+        mul_acc(h[2], mu[0], c0, c1, c2);
+        c0 = c1;
+        c1 = c2;
+        c2 = 0;
+
+        mul_acc(h[0], mu[3], c0, c1, c2);
+        mul_acc(h[1], mu[2], c0, c1, c2);
+        mul_acc(h[2], mu[1], c0, c1, c2);
+        mul_acc(h[3], mu[0], c0, c1, c2);
+        c0 = c1;
+        c1 = c2;
+        c2 = 0;
+
+        uint64_t q[4], carry = 0;
+        mul_acc(h[1], mu[3], c0, c1, c2);
+        mul_acc(h[2], mu[2], c0, c1, c2);
+        mul_acc(h[3], mu[1], c0, c1, c2);
+        q[0] = addc64(c0, h[0], carry);
+        c0 = c1;
+        c1 = c2;
+        c2 = 0;
+
+        mul_acc(h[2], mu[3], c0, c1, c2);
+        mul_acc(h[3], mu[2], c0, c1, c2);
+        q[1] = addc64(c0, h[1], carry);
+        c0 = c1;
+        c1 = c2;
+        c2 = 0;
+
+        mul_acc(h[3], mu[3], c0, c1, c2);
+        q[2] = addc64(c0, h[2], carry);
+        q[3] = addc64(c1, h[3], carry);
+
+        // u - q * m is less than 5m, so only the lowest 5 limbs of q * m are needed
+        uint64_t p[5];
+        p[0] = mul64(q[0], m[0], c0);
+        c1 = c2 = 0;
+        mul_acc(q[0], m[1], c0, c1, c2);
+        mul_acc(q[1], m[0], c0, c1, c2);
+        p[1] = c0;
+        c0 = c1;
+        c1 = c2;
+        c2 = 0;
+
+        mul_acc(q[0], m[2], c0, c1, c2);
+        mul_acc(q[1], m[1], c0, c1, c2);
+        mul_acc(q[2], m[0], c0, c1, c2);
+        p[2] = c0;
+        c0 = c1;
+        c1 = c2;
+        c2 = 0;
+
+        mul_acc(q[0], m[3], c0, c1, c2);
+        mul_acc(q[1], m[2], c0, c1, c2);
+        mul_acc(q[2], m[1], c0, c1, c2);
+        mul_acc(q[3], m[0], c0, c1, c2);
+        p[3] = c0;
+
+        p[4] = c1 + q[1] * m[3] + q[2] * m[2] + q[3] * m[1];
+
+        uint64_t borrow = 0;
+        uint64_t d0 = subb64(u[0], p[0], borrow);
+        uint64_t d1 = subb64(u[1], p[1], borrow);
+        uint64_t d2 = subb64(u[2], p[2], borrow);
+        uint64_t d3 = subb64(u[3], p[3], borrow);
+        uint64_t d4 = subb64(u[4], p[4], borrow);
+
+        while (d4 || ((d3 > m[3]) || ((d3 == m[3]) && ((d2 > m[2]) || ((d2 == m[2]) && ((d1 > m[1]) || ((d1 == m[1]) && (d0 >= m[0])))))))){
+            borrow = 0;
+            d0 = subb64(d0, m[0], borrow);
+            d1 = subb64(d1, m[1], borrow);
+            d2 = subb64(d2, m[2], borrow);
+            d3 = subb64(d3, m[3], borrow);
+            d4 -= borrow;
+        }
+
+        // d < m, so the top limb is 0
+        const uint64_t d[5] = {d0, d1, d2, d3, 0};
+        for(int i = 0; i < 4; i++){
+            const uint64_t lo = (i + words < 4)?d[i + words]:0;
+            const uint64_t hi = (i + words < 3)?d[i + words + 1]:0;
+            r[i] = (lo >> bits) | ((hi << 1) << (63 - bits));
+        }
+    }
+
+    // 128 / 64 -> 64 bit division; hi must be less than d
+    UINT256_T_INLINE uint64_t div128(const uint64_t hi, const uint64_t lo, const uint64_t d, uint64_t & rem){
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+        uint64_t q;
+        __asm__("divq %4" : "=a"(q), "=d"(rem) : "a"(lo), "d"(hi), "rm"(d));
+        return q;
+#elif defined(_MSC_VER) && defined(_M_X64) && (_MSC_VER >= 1920)
+        return _udiv128(hi, lo, d, &rem);
+#else
+        // Hacker's Delight divlu: two 64 / 32 digit steps on the normalized divisor
+        const uint64_t b = 1ULL << 32;
+        const unsigned int s = clz64(d);
+        const uint64_t v = d << s;
+        const uint64_t vn1 = v >> 32, vn0 = v & 0xffffffffULL;
+        const uint64_t un32 = (hi << s) | (s?(lo >> (64 - s)):0);
+        const uint64_t un10 = lo << s;
+        const uint64_t un1 = un10 >> 32, un0 = un10 & 0xffffffffULL;
+
+        uint64_t q1 = un32 / vn1;
+        uint64_t rhat = un32 - q1 * vn1;
+        while ((q1 >= b) || (q1 * vn0 > ((rhat << 32) | un1))){
+            q1--;
+            rhat += vn1;
+            if (rhat >= b){
+                break;
+            }
+        }
+
+        const uint64_t un21 = (un32 << 32) + un1 - q1 * v;
+        uint64_t q0 = un21 / vn1;
+        rhat = un21 - q0 * vn1;
+        while ((q0 >= b) || (q0 * vn0 > ((rhat << 32) | un0))){
+            q0--;
+            rhat += vn1;
+            if (rhat >= b){
+                break;
+            }
+        }
+
+        rem = ((un21 << 32) + un0 - q0 * v) >> s;
+        return (q1 << 32) | q0;
+#endif
+    }
+
+    // limbs /= d in place, one 128 / 64 step per limb; returns the remainder
+    UINT256_T_INLINE uint64_t divmod_limb(uint64_t limbs[4], const uint64_t d){
+        uint64_t r = 0;
+        for(int j = 3; j >= 0; j--){
+            limbs[j] = div128(r, limbs[j], d, r);
+        }
+        return r;
+    }
+
+    const char lower_digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+    const char upper_digits[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+    // writes value backwards, ending just before p, zero padded to at least min_digits
+    // returns the first digit written
+    UINT256_T_INLINE char * format_u64(char * p, uint64_t value, const uint8_t base, const unsigned int min_digits, const char * digits){
+        char * const stop = p - min_digits;
+        if (base == 10){
+            // constant divisor so that the compiler can use a multiplication
+            do{
+                *--p = (char) ('0' + (value % 10));
+                value /= 10;
+            } while (value);
+        }
+        else{
+            do{
+                *--p = digits[value % base];
+                value /= base;
+            } while (value);
+        }
+        while (p > stop){
+            *--p = '0';
+        }
+        return p;
+    }
+
+    // writes the digits of limbs backwards, ending just before end; limbs are destroyed
+    // returns the first digit written
+    UINT256_T_INLINE char * format_limbs(char * end, uint64_t limbs[4], const uint8_t base, const char * digits){
+        char * p = end;
+        if (!(base & (base - 1))){
+            // power of 2 bases: every digit is a group of bits
+            const unsigned int width = ctz64(base);
+            const uint64_t mask = base - 1;
+
+            int top = 3;
+            while ((top > 0) && !limbs[top]){
+                top--;
+            }
+            const unsigned int significant = limbs[top]?(64 * top + 64 - clz64(limbs[top])):1;
+
+            for(unsigned int pos = 0; pos < significant; pos += width){
+                const unsigned int limb = pos / 64;
+                const unsigned int offset = pos % 64;
+                uint64_t digit = limbs[limb] >> offset;
+                if ((offset + width > 64) && (limb < 3)){
+                    digit |= limbs[limb + 1] << (64 - offset);
+                }
+                *--p = digits[digit & mask];
+            }
+        }
+        else{
+            // largest power of the base that fits in a limb, and its number of digits
+            uint64_t chunk = base;
+            unsigned int chunk_digits = 1;
+            while (chunk <= ((uint64_t) -1) / base){
+                chunk *= base;
+                chunk_digits++;
+            }
+
+            // peel off whole chunks until the rest fits in a limb
+            while (limbs[3] || limbs[2] || limbs[1]){
+                p = format_u64(p, divmod_limb(limbs, chunk), base, chunk_digits, digits);
+            }
+            p = format_u64(p, limbs[0], base, 1, digits);
+        }
+        return p;
+    }
+
+    // Division by invariant integers using precomputed reciprocals
+    // Moller and Granlund, "Improved division by invariant integers" (2011)
+
+    // floor((2^128 - 1) / d) - 2^64 for a normalized d
+    UINT256_T_INLINE uint64_t reciprocal_2by1(const uint64_t d){
+        uint64_t rem;
+        return div128(~d, (uint64_t) -1, d, rem);
+    }
+
+    // floor((2^192 - 1) / (d1, d0)) - 2^64 for a normalized d1
+    UINT256_T_INLINE uint64_t reciprocal_3by2(const uint64_t d1, const uint64_t d0){
+        uint64_t v = reciprocal_2by1(d1);
+        uint64_t p = d1 * v + d0;
+        if (p < d0){
+            v--;
+            if (p >= d1){
+                v--;
+                p -= d1;
+            }
+            p -= d1;
+        }
+
+        uint64_t t1;
+        const uint64_t t0 = mul64(d0, v, t1);
+        p += t1;
+        if (p < t1){
+            v--;
+            if ((p > d1) || ((p == d1) && (t0 >= d0))){
+                v--;
+            }
+        }
+        return v;
+    }
+
+    // (nh, nl) / d with the reciprocal v of a normalized d; nh must be less than d
+    UINT256_T_INLINE uint64_t div2by1(const uint64_t nh, const uint64_t nl, const uint64_t d, const uint64_t v, uint64_t & rem){
+        uint64_t qh;
+        uint64_t ql = mul64(nh, v, qh);
+        ql += nl;
+        qh += nh + 1 + (ql < nl);
+
+        uint64_t r = nl - qh * d;
+        if (r > ql){
+            qh--;
+            r += d;
+        }
+        if (r >= d){
+            qh++;
+            r -= d;
+        }
+        rem = r;
+        return qh;
+    }
+
+    // (n2, n1, n0) / (d1, d0) with the reciprocal v of a normalized (d1, d0)
+    // (n2, n1) must be less than (d1, d0)
+    UINT256_T_INLINE uint64_t div3by2(const uint64_t n2, const uint64_t n1, const uint64_t n0,
+                     const uint64_t d1, const uint64_t d0, const uint64_t v,
+                     uint64_t & r1, uint64_t & r0){
+        uint64_t q;
+        uint64_t q0 = mul64(n2, v, q);
+        q0 += n1;
+        q += n2 + (q0 < n1);
+
+        // (r1, r0) = (n1, n0) - q * (d1, d0) - (d1, d0)
+        r1 = n1 - d1 * q;
+        r1 = r1 - d1 - (n0 < d0);
+        r0 = n0 - d0;
+        uint64_t t1;
+        const uint64_t t0 = mul64(d0, q, t1);
+        r1 = r1 - t1 - (r0 < t0);
+        r0 -= t0;
+        q++;
+
+        if (r1 >= q0){
+            q--;
+            r0 += d0;
+            r1 += d1 + (r0 < d0);
+        }
+        if ((r1 > d1) || ((r1 == d1) && (r0 >= d0))){
+            q++;
+            r1 = r1 - d1 - (r0 < d0);
+            r0 -= d0;
+        }
+        return q;
+    }
+
+    // r[0, n) -= q * d[0, n); returns the limb that still has to be subtracted above r
+    UINT256_T_INLINE uint64_t submul(uint64_t * r, const uint64_t * d, const int n, const uint64_t q){
+        uint64_t carry = 0;
+        for(int i = 0; i < n; i++){
+            uint64_t p_hi;
+            uint64_t p_lo = mul64(q, d[i], p_hi);
+            p_lo += carry;
+            p_hi += (p_lo < carry);
+            p_hi += (r[i] < p_lo);
+            r[i] -= p_lo;
+            carry = p_hi;
+        }
+        return carry;
+    }
+
+    // r[0, n) += d[0, n); returns the carry
+    UINT256_T_INLINE uint64_t addback(uint64_t * r, const uint64_t * d, const int n){
+        uint64_t carry = 0;
+        for(int i = 0; i < n; i++){
+            const uint64_t sum = r[i] + d[i];
+            const uint64_t c = (sum < d[i]);
+            r[i] = sum + carry;
+            carry = c | (r[i] < carry);
+        }
+        return carry;
+    }
+
+    // limbs = limbs * multiplier + addend; returns the limb carried out of the top
+    UINT256_T_INLINE uint64_t mul_add(uint64_t limbs[4], const uint64_t multiplier, uint64_t addend){
+        for(int i = 0; i < 4; i++){
+            uint64_t hi;
+            uint64_t lo = mul64(limbs[i], multiplier, hi);
+            lo += addend;
+            hi += (lo < addend);
+            limbs[i] = lo;
+            addend = hi;
+        }
+        return addend;
+    }
+
+    // limbs = (limbs << shift) | addend, for 0 < shift <= 64; returns the bits shifted out of the top
+    UINT256_T_INLINE uint64_t shift_add(uint64_t limbs[4], const unsigned int shift, const uint64_t addend){
+        if (shift == 64){
+            const uint64_t out = limbs[3];
+            limbs[3] = limbs[2];
+            limbs[2] = limbs[1];
+            limbs[1] = limbs[0];
+            limbs[0] = addend;
+            return out;
+        }
+        const uint64_t out = limbs[3] >> (64 - shift);
+        for(int i = 3; i > 0; i--){
+            limbs[i] = (limbs[i] << shift) | (limbs[i - 1] >> (64 - shift));
+        }
+        limbs[0] = (limbs[0] << shift) | addend;
+        return out;
+    }
+
+    // value of each character as a digit in bases up to 36, or 36 if it is not a digit
+    const uint8_t digit_values[256] = {
+        36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+         0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 36, 36, 36, 36, 36, 36,
+        36, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+        25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 36, 36, 36, 36,
+        36, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+        25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 36, 36, 36, 36,
+        36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    };
+
+    UINT256_T_INLINE unsigned int digit_value(const char c){
+        return digit_values[(unsigned char) c];
+    }
+
+    // Parses the longest run of digits at the front of [first, last)
+    // Digits are gathered into a limb as many at a time as fit, and then
+    // folded into the value with a single multiply-add (or shift for power
+    // of 2 bases). overflow is set if the value does not fit in 256 bits.
+    // Returns the first character that is not a digit.
+    UINT256_T_INLINE const char * parse_limbs(const char * first, const char * last, const uint8_t base, uint64_t limbs[4], bool & overflow){
+        limbs[0] = limbs[1] = limbs[2] = limbs[3] = 0;
+        overflow = false;
+
+        const bool power_of_2 = !(base & (base - 1));
+        const unsigned int width = ctz64(base);
+        unsigned int chunk_digits = 1;
+        if (power_of_2){
+            chunk_digits = 64 / width;
+        }
+        else{
+            for(uint64_t chunk = base; chunk <= ((uint64_t) -1) / base; chunk *= base){
+                chunk_digits++;
+            }
+        }
+
+        while (first != last){
+            uint64_t chunk = 0;
+            uint64_t scale = 1;
+            unsigned int digits = 0;
+            while ((first != last) && (digits < chunk_digits)){
+                const unsigned int digit = digit_value(*first);
+                if (digit >= base){
+                    break;
+                }
+                chunk = chunk * base + digit;
+                scale *= base;
+                digits++;
+                first++;
+            }
+
+            if (digits){
+                if (power_of_2){
+                    overflow |= (shift_add(limbs, digits * width, chunk) != 0);
+                }
+                else{
+                    overflow |= (mul_add(limbs, scale, chunk) != 0);
+                }
+            }
+
+            if (digits < chunk_digits){
+                break;
+            }
+        }
+        return first;
+    }
+
+    enum parse_status{
+        PARSE_OK,
+        PARSE_INVALID,
+        PARSE_OVERFLOW,
+    };
+
+    // parses all of [first, last) as a number in base, which must have at
+    // least one digit; hexadecimal and binary numbers may start with 0x or 0b
+    UINT256_T_INLINE parse_status parse_number(const char * first, const char * last, const uint8_t base, uint64_t limbs[4]){
+        if (((last - first) >= 2) && (first[0] == '0') &&
+            (((base == 16) && ((first[1] == 'x') || (first[1] == 'X'))) ||
+             ((base == 2)  && ((first[1] == 'b') || (first[1] == 'B'))))){
+            first += 2;
+        }
+
+        if (first == last){
+            return PARSE_INVALID;
+        }
+
+        bool overflow;
+        if (parse_limbs(first, last, base, limbs, overflow) != last){
+            return PARSE_INVALID;
+        }
+        return overflow?PARSE_OVERFLOW:PARSE_OK;
+    }
+UINT256_T_DETAIL_END
+
+UINT256_T_INLINE uint256_t::uint256_t(const std::string & s) {
+    init(s.data(), s.data() + s.size());
+}
+
+UINT256_T_INLINE uint256_t::uint256_t(const char * s) {
+    init(s, s + strlen(s));
+}
 
-uint256_t::uint256_t(const std::string & s, uint8_t base) {
-    init_from_base(s.c_str(), base);
+UINT256_T_INLINE uint256_t::uint256_t(const std::string & s, uint8_t base) {
+    init_from_base(s.data(), s.data() + s.size(), base);
 }
 
-uint256_t::uint256_t(const char * s, uint8_t base) {
-    init_from_base(s, base);
+UINT256_T_INLINE uint256_t::uint256_t(const char * s, uint8_t base) {
+    init_from_base(s, s + strlen(s), base);
 }
 
-uint256_t::uint256_t(const bool & b)
+UINT256_T_INLINE uint256_t::uint256_t(const bool & b)
     : uint256_t((uint8_t) b)
 {}
 
-void uint256_t::init_from_base(const char * s, uint8_t base) {
-    *this = 0;
+UINT256_T_INLINE void uint256_t::init(const char * first, const char * last) {
+    // hexadecimal and binary strings are recognized by their prefix
+    const bool prefix = ((last - first) >= 2) && (first[0] == '0');
+    if (prefix && ((first[1] == 'x') || (first[1] == 'X'))){
+        init_from_base(first, last, 16);
+    }
+    else if (prefix && ((first[1] == 'b') || (first[1] == 'B'))){
+        init_from_base(first, last, 2);
+    }
+    else{
+        init_from_base(first, last, 10);
+    }
+}
+
+UINT256_T_INLINE void uint256_t::init_from_base(const char * first, const char * last, uint8_t base) {
+    if ((base < 2) || (base > 36)){
+        throw std::invalid_argument("Base must be in the range 2-36");
+    }
 
-    uint256_t power(1);
-    uint8_t digit;
-    int pos = strlen(s) - 1;
-    while(pos >= 0) {
-        digit = 0;
-        if('0' <= s[pos] && s[pos] <= '9') {
-            digit = s[pos] - '0';
-        } else if('a' <= s[pos] && s[pos] <= 'z') {
-            digit = s[pos] - 'a' + 10;
-        }
-        *this += digit * power;
-        pos--;
-        power *= base;
+    uint64_t limbs[4];
+    switch (uint256_t_detail::parse_number(first, last, base, limbs)){
+        case uint256_t_detail::PARSE_INVALID:
+            throw std::invalid_argument("Error: string contains characters that are not digits in the given base");
+        case uint256_t_detail::PARSE_OVERFLOW:
+            throw std::out_of_range("Error: value does not fit in 256 bits");
+        default:
+            break;
     }
+    *this = uint256_t_detail::from_limbs(limbs);
 }
 
-uint256_t & uint256_t::operator=(const bool & rhs) {
+UINT256_T_INLINE uint256_t & uint256_t::operator=(const bool & rhs) {
+#ifdef UINT256_T_LIMBS
+    limb(0) = rhs;
+    limb(1) = limb(2) = limb(3) = 0;
+#else
     UPPER = 0;
     LOWER = rhs;
+#endif
     return *this;
 }
 
-uint256_t::operator bool() const{
+#ifndef UINT256_T_LIMBS
+UINT256_T_INLINE uint256_t::operator bool() const{
     return (bool) (UPPER | LOWER);
 }
 
-uint256_t::operator uint8_t() const{
+UINT256_T_INLINE uint256_t::operator uint8_t() const{
     return (uint8_t) LOWER;
 }
 
-uint256_t::operator uint16_t() const{
+UINT256_T_INLINE uint256_t::operator uint16_t() const{
     return (uint16_t) LOWER;
 }
 
-uint256_t::operator uint32_t() const{
+UINT256_T_INLINE uint256_t::operator uint32_t() const{
     return (uint32_t) LOWER;
 }
 
-uint256_t::operator uint64_t() const{
+UINT256_T_INLINE uint256_t::operator uint64_t() const{
     return (uint64_t) LOWER;
 }
+#endif
 
-uint256_t::operator uint128_t() const{
+UINT256_T_INLINE uint256_t::operator uint128_t() const{
+#ifdef UINT256_T_LIMBS
+    return uint128_t(limb(1), limb(0));
+#else
     return LOWER;
+#endif
 }
 
-uint256_t uint256_t::operator&(const uint128_t & rhs) const{
+UINT256_T_INLINE uint256_t uint256_t::operator&(const uint128_t & rhs) const{
+#ifdef UINT256_T_LIMBS
+    return *this & uint256_t(rhs);
+#else
     return uint256_t(uint128_0, LOWER & rhs);
+#endif
 }
 
-uint256_t uint256_t::operator&(const uint256_t & rhs) const{
+#ifndef UINT256_T_LIMBS
+UINT256_T_INLINE uint256_t uint256_t::operator&(const uint256_t & rhs) const{
     return uint256_t(UPPER & rhs.UPPER, LOWER & rhs.LOWER);
 }
+#endif
 
-uint256_t & uint256_t::operator&=(const uint128_t & rhs){
+UINT256_T_INLINE uint256_t & uint256_t::operator&=(const uint128_t & rhs){
+#ifdef UINT256_T_LIMBS
+    *this &= uint256_t(rhs);
+#else
     UPPER  = uint128_0;
     LOWER &= rhs;
+#endif
     return *this;
 }
 
-uint256_t & uint256_t::operator&=(const uint256_t & rhs){
+UINT256_T_INLINE uint256_t & uint256_t::operator&=(const uint256_t & rhs){
+#ifdef UINT256_T_LIMBS
+    for(int i = 0; i < 4; i++){
+        LIMBS[i] &= rhs.LIMBS[i];
+    }
+#else
     UPPER &= rhs.UPPER;
     LOWER &= rhs.LOWER;
+#endif
     return *this;
 }
 
-uint256_t uint256_t::operator|(const uint128_t & rhs) const{
+UINT256_T_INLINE uint256_t uint256_t::operator|(const uint128_t & rhs) const{
+#ifdef UINT256_T_LIMBS
+    return *this | uint256_t(rhs);
+#else
     return uint256_t(UPPER , LOWER | rhs);
+#endif
 }
 
-uint256_t uint256_t::operator|(const uint256_t & rhs) const{
+#ifndef UINT256_T_LIMBS
+UINT256_T_INLINE uint256_t uint256_t::operator|(const uint256_t & rhs) const{
     return uint256_t(UPPER | rhs.UPPER, LOWER | rhs.LOWER);
 }
+#endif
 
-uint256_t & uint256_t::operator|=(const uint128_t & rhs){
+UINT256_T_INLINE uint256_t & uint256_t::operator|=(const uint128_t & rhs){
+#ifdef UINT256_T_LIMBS
+    *this |= uint256_t(rhs);
+#else
     LOWER |= rhs;
+#endif
     return *this;
 }
 
-uint256_t & uint256_t::operator|=(const uint256_t & rhs){
+UINT256_T_INLINE uint256_t & uint256_t::operator|=(const uint256_t & rhs){
+#ifdef UINT256_T_LIMBS
+    for(int i = 0; i < 4; i++){
+        LIMBS[i] |= rhs.LIMBS[i];
+    }
+#else
     UPPER |= rhs.UPPER;
     LOWER |= rhs.LOWER;
+#endif
     return *this;
 }
 
-uint256_t uint256_t::operator^(const uint128_t & rhs) const{
+UINT256_T_INLINE uint256_t uint256_t::operator^(const uint128_t & rhs) const{
+#ifdef UINT256_T_LIMBS
+    return *this ^ uint256_t(rhs);
+#else
     return uint256_t(UPPER, LOWER ^ rhs);
+#endif
 }
 
-uint256_t uint256_t::operator^(const uint256_t & rhs) const{
+#ifndef UINT256_T_LIMBS
+UINT256_T_INLINE uint256_t uint256_t::operator^(const uint256_t & rhs) const{
     return uint256_t(UPPER ^ rhs.UPPER, LOWER ^ rhs.LOWER);
 }
+#endif
 
-uint256_t & uint256_t::operator^=(const uint128_t & rhs){
+UINT256_T_INLINE uint256_t & uint256_t::operator^=(const uint128_t & rhs){
+#ifdef UINT256_T_LIMBS
+    *this ^= uint256_t(rhs);
+#else
     LOWER ^= rhs;
+#endif
     return *this;
 }
 
-uint256_t & uint256_t::operator^=(const uint256_t & rhs){
+UINT256_T_INLINE uint256_t & uint256_t::operator^=(const uint256_t & rhs){
+#ifdef UINT256_T_LIMBS
+    for(int i = 0; i < 4; i++){
+        LIMBS[i] ^= rhs.LIMBS[i];
+    }
+#else
     UPPER ^= rhs.UPPER;
     LOWER ^= rhs.LOWER;
+#endif
     return *this;
 }
 
-uint256_t uint256_t::operator~() const{
+#ifndef UINT256_T_LIMBS
+UINT256_T_INLINE uint256_t uint256_t::operator~() const{
     return uint256_t(~UPPER, ~LOWER);
 }
+#endif
 
-uint256_t uint256_t::operator<<(const uint128_t & rhs) const{
-    return *this << uint256_t(rhs);
-}
-
-uint256_t uint256_t::operator<<(const uint256_t & rhs) const{
-    const uint128_t shift = rhs.LOWER;
-    if (((bool) rhs.UPPER) || (shift >= uint128_256)){
-        return uint256_0;
-    }
-    else if (shift == uint128_128){
-        return uint256_t(LOWER, uint128_0);
-    }
-    else if (shift == uint128_0){
-        return *this;
-    }
-    else if (shift < uint128_128){
-        return uint256_t((UPPER << shift) + (LOWER >> (uint128_128 - shift)), LOWER << shift);
-    }
-    else if ((uint128_256 > shift) && (shift > uint128_128)){
-        return uint256_t(LOWER << (shift - uint128_128), uint128_0);
-    }
-    else{
+UINT256_T_INLINE uint256_t uint256_t::operator<<(const unsigned int shift) const{
+    if (shift >= 256){
         return uint256_0;
     }
+    uint64_t limbs[4];
+    uint256_t_detail::to_limbs(*this, limbs);
+    uint256_t_detail::shl256(limbs[0], limbs[1], limbs[2], limbs[3], shift);
+    return uint256_t_detail::from_limbs(limbs);
+}
+
+UINT256_T_INLINE uint256_t uint256_t::operator<<(const uint128_t & rhs) const{
+    return (rhs < uint128_256)?(*this << (unsigned int) (uint64_t) rhs):uint256_0;
 }
 
-uint256_t & uint256_t::operator<<=(const uint128_t & shift){
-    return *this <<= uint256_t(shift);
+UINT256_T_INLINE uint256_t uint256_t::operator<<(const uint256_t & rhs) const{
+    return (((bool) rhs.upper()) || (rhs.lower() >= uint128_256))?uint256_0:(*this << rhs.lower());
 }
 
-uint256_t & uint256_t::operator<<=(const uint256_t & shift){
+UINT256_T_INLINE uint256_t & uint256_t::operator<<=(const unsigned int shift){
     *this = *this << shift;
     return *this;
 }
 
-uint256_t uint256_t::operator>>(const uint128_t & rhs) const{
-    return *this >> uint256_t(rhs);
+UINT256_T_INLINE uint256_t & uint256_t::operator<<=(const uint128_t & shift){
+    *this = *this << shift;
+    return *this;
 }
 
-uint256_t uint256_t::operator>>(const uint256_t & rhs) const{
-    const uint128_t shift = rhs.LOWER;
-    if (((bool) rhs.UPPER) | (shift >= uint128_256)){
-        return uint256_0;
-    }
-    else if (shift == uint128_128){
-        return uint256_t(UPPER);
-    }
-    else if (shift == uint128_0){
-        return *this;
-    }
-    else if (shift < uint128_128){
-        return uint256_t(UPPER >> shift, (UPPER << (uint128_128 - shift)) + (LOWER >> shift));
-    }
-    else if ((uint128_256 > shift) && (shift > uint128_128)){
-        return uint256_t(UPPER >> (shift - uint128_128));
-    }
-    else{
+UINT256_T_INLINE uint256_t & uint256_t::operator<<=(const uint256_t & shift){
+    *this = *this << shift;
+    return *this;
+}
+
+UINT256_T_INLINE uint256_t uint256_t::operator>>(const unsigned int shift) const{
+    if (shift >= 256){
         return uint256_0;
     }
+    uint64_t limbs[4];
+    uint256_t_detail::to_limbs(*this, limbs);
+    uint256_t_detail::shr256(limbs[0], limbs[1], limbs[2], limbs[3], shift);
+    return uint256_t_detail::from_limbs(limbs);
+}
+
+UINT256_T_INLINE uint256_t uint256_t::operator>>(const uint128_t & rhs) const{
+    return (rhs < uint128_256)?(*this >> (unsigned int) (uint64_t) rhs):uint256_0;
+}
+
+UINT256_T_INLINE uint256_t uint256_t::operator>>(const uint256_t & rhs) const{
+    return (((bool) rhs.upper()) || (rhs.lower() >= uint128_256))?uint256_0:(*this >> rhs.lower());
+}
+
+UINT256_T_INLINE uint256_t & uint256_t::operator>>=(const unsigned int shift){
+    *this = *this >> shift;
+    return *this;
 }
 
-uint256_t & uint256_t::operator>>=(const uint128_t & shift){
-    return *this >>= uint256_t(shift);
+UINT256_T_INLINE uint256_t & uint256_t::operator>>=(const uint128_t & shift){
+    *this = *this >> shift;
+    return *this;
 }
 
-uint256_t & uint256_t::operator>>=(const uint256_t & shift){
+UINT256_T_INLINE uint256_t & uint256_t::operator>>=(const uint256_t & shift){
     *this = *this >> shift;
     return *this;
 }
 
-bool uint256_t::operator!() const{
+#ifndef UINT256_T_LIMBS
+UINT256_T_INLINE bool uint256_t::operator!() const{
     return ! (bool) *this;
 }
+#endif
 
-bool uint256_t::operator&&(const uint128_t & rhs) const{
+UINT256_T_INLINE bool uint256_t::operator&&(const uint128_t & rhs) const{
     return (*this && uint256_t(rhs));
 }
 
-bool uint256_t::operator&&(const uint256_t & rhs) const{
+UINT256_T_INLINE bool uint256_t::operator&&(const uint256_t & rhs) const{
     return ((bool) *this && (bool) rhs);
 }
 
-bool uint256_t::operator||(const uint128_t & rhs) const{
+UINT256_T_INLINE bool uint256_t::operator||(const uint128_t & rhs) const{
     return (*this || uint256_t(rhs));
 }
 
-bool uint256_t::operator||(const uint256_t & rhs) const{
+UINT256_T_INLINE bool uint256_t::operator||(const uint256_t & rhs) const{
     return ((bool) *this || (bool) rhs);
 }
 
-bool uint256_t::operator==(const uint128_t & rhs) const{
-    return (*this == uint256_t(rhs));
+#ifndef UINT256_T_LIMBS
+UINT256_T_INLINE int uint256_t::compare(const uint256_t & rhs) const{
+    // the first limb that differs, most significant first, decides
+    if (UPPER.upper() != rhs.UPPER.upper()){
+        return uint256_t_detail::cmp64(UPPER.upper(), rhs.UPPER.upper());
+    }
+    if (UPPER.lower() != rhs.UPPER.lower()){
+        return uint256_t_detail::cmp64(UPPER.lower(), rhs.UPPER.lower());
+    }
+    if (LOWER.upper() != rhs.LOWER.upper()){
+        return uint256_t_detail::cmp64(LOWER.upper(), rhs.LOWER.upper());
+    }
+    return uint256_t_detail::cmp64(LOWER.lower(), rhs.LOWER.lower());
+}
+#endif
+
+UINT256_T_INLINE bool uint256_t::operator==(const uint128_t & rhs) const{
+    return (!upper() && (lower() == rhs));
 }
 
-bool uint256_t::operator==(const uint256_t & rhs) const{
+#ifndef UINT256_T_LIMBS
+UINT256_T_INLINE bool uint256_t::operator==(const uint256_t & rhs) const{
     return ((UPPER == rhs.UPPER) && (LOWER == rhs.LOWER));
 }
+#endif
 
-bool uint256_t::operator!=(const uint128_t & rhs) const{
-    return (*this != uint256_t(rhs));
+UINT256_T_INLINE bool uint256_t::operator!=(const uint128_t & rhs) const{
+    return (upper() || (lower() != rhs));
 }
 
-bool uint256_t::operator!=(const uint256_t & rhs) const{
+#ifndef UINT256_T_LIMBS
+UINT256_T_INLINE bool uint256_t::operator!=(const uint256_t & rhs) const{
     return ((UPPER != rhs.UPPER) | (LOWER != rhs.LOWER));
 }
+#endif
 
-bool uint256_t::operator>(const uint128_t & rhs) const{
-    return (*this > uint256_t(rhs));
+UINT256_T_INLINE bool uint256_t::operator>(const uint128_t & rhs) const{
+    return (upper() || (lower() > rhs));
 }
 
-bool uint256_t::operator>(const uint256_t & rhs) const{
-    if (UPPER == rhs.UPPER){
-        return (LOWER > rhs.LOWER);
-    }
-    if (UPPER > rhs.UPPER){
-        return true;
-    }
-    return false;
+#ifndef UINT256_T_LIMBS
+UINT256_T_INLINE bool uint256_t::operator>(const uint256_t & rhs) const{
+    return compare(rhs) > 0;
 }
+#endif
 
-bool uint256_t::operator<(const uint128_t & rhs) const{
-    return (*this < uint256_t(rhs));
+UINT256_T_INLINE bool uint256_t::operator<(const uint128_t & rhs) const{
+    return (!upper() && (lower() < rhs));
 }
 
-bool uint256_t::operator<(const uint256_t & rhs) const{
-    if (UPPER == rhs.UPPER){
-        return (LOWER < rhs.LOWER);
-    }
-    if (UPPER < rhs.UPPER){
-        return true;
-    }
-    return false;
+#ifdef UINT256_T_LIMBS
+UINT256_T_INLINE bool uint256_t::less(const uint256_t & rhs) const{
+    // lhs < rhs exactly when lhs - rhs borrows
+    uint64_t borrow = 0;
+    uint256_t_detail::subb64(limb(0), rhs.limb(0), borrow);
+    uint256_t_detail::subb64(limb(1), rhs.limb(1), borrow);
+    uint256_t_detail::subb64(limb(2), rhs.limb(2), borrow);
+    uint256_t_detail::subb64(limb(3), rhs.limb(3), borrow);
+    return borrow;
 }
 
-bool uint256_t::operator>=(const uint128_t & rhs) const{
-    return (*this >= uint256_t(rhs));
+UINT256_T_INLINE int uint256_t::compare_limbs(const uint256_t & rhs) const{
+    // one borrow chain: the differences are all zero only when equal
+    uint64_t borrow = 0;
+    uint64_t nonzero = uint256_t_detail::subb64(limb(0), rhs.limb(0), borrow);
+    nonzero |= uint256_t_detail::subb64(limb(1), rhs.limb(1), borrow);
+    nonzero |= uint256_t_detail::subb64(limb(2), rhs.limb(2), borrow);
+    nonzero |= uint256_t_detail::subb64(limb(3), rhs.limb(3), borrow);
+    return (int) (nonzero != 0) - 2 * (int) borrow;
+}
+#else
+UINT256_T_INLINE bool uint256_t::operator<(const uint256_t & rhs) const{
+    return compare(rhs) < 0;
+}
+#endif
+
+UINT256_T_INLINE bool uint256_t::operator>=(const uint128_t & rhs) const{
+    return (upper() || (lower() >= rhs));
 }
 
-bool uint256_t::operator>=(const uint256_t & rhs) const{
-    return ((*this > rhs) | (*this == rhs));
+#ifndef UINT256_T_LIMBS
+UINT256_T_INLINE bool uint256_t::operator>=(const uint256_t & rhs) const{
+    return compare(rhs) >= 0;
 }
+#endif
 
-bool uint256_t::operator<=(const uint128_t & rhs) const{
-    return (*this <= uint256_t(rhs));
+UINT256_T_INLINE bool uint256_t::operator<=(const uint128_t & rhs) const{
+    return (!upper() && (lower() <= rhs));
 }
 
-bool uint256_t::operator<=(const uint256_t & rhs) const{
-    return ((*this < rhs) | (*this == rhs));
+#ifndef UINT256_T_LIMBS
+UINT256_T_INLINE bool uint256_t::operator<=(const uint256_t & rhs) const{
+    return compare(rhs) <= 0;
 }
+#endif
 
-uint256_t uint256_t::operator+(const uint128_t & rhs) const{
+UINT256_T_INLINE uint256_t uint256_t::operator+(const uint128_t & rhs) const{
     return *this + uint256_t(rhs);
 }
 
-uint256_t uint256_t::operator+(const uint256_t & rhs) const{
+#ifdef UINT256_T_LIMBS
+UINT256_T_INLINE uint256_t uint256_t::add(const uint256_t & rhs) const{
+    uint256_t out;
+    uint64_t carry = 0;
+    out.limb(0) = uint256_t_detail::addc64(limb(0), rhs.limb(0), carry);
+    out.limb(1) = uint256_t_detail::addc64(limb(1), rhs.limb(1), carry);
+    out.limb(2) = uint256_t_detail::addc64(limb(2), rhs.limb(2), carry);
+    out.limb(3) = uint256_t_detail::addc64(limb(3), rhs.limb(3), carry);
+    return out;
+}
+#else
+UINT256_T_INLINE uint256_t uint256_t::operator+(const uint256_t & rhs) const{
     return uint256_t(UPPER + rhs.UPPER + (((LOWER + rhs.LOWER) < LOWER)?uint128_1:uint128_0), LOWER + rhs.LOWER);
 }
+#endif
 
-uint256_t & uint256_t::operator+=(const uint128_t & rhs){
+UINT256_T_INLINE uint256_t & uint256_t::operator+=(const uint128_t & rhs){
     return *this += uint256_t(rhs);
 }
 
-uint256_t & uint256_t::operator+=(const uint256_t & rhs){
+UINT256_T_INLINE uint256_t & uint256_t::operator+=(const uint256_t & rhs){
+#ifdef UINT256_T_LIMBS
+    uint64_t carry = 0;
+    limb(0) = uint256_t_detail::addc64(limb(0), rhs.limb(0), carry);
+    limb(1) = uint256_t_detail::addc64(limb(1), rhs.limb(1), carry);
+    limb(2) = uint256_t_detail::addc64(limb(2), rhs.limb(2), carry);
+    limb(3) = uint256_t_detail::addc64(limb(3), rhs.limb(3), carry);
+#else
     UPPER = rhs.UPPER + UPPER + ((LOWER + rhs.LOWER) < LOWER);
     LOWER = LOWER + rhs.LOWER;
+#endif
     return *this;
 }
 
-uint256_t uint256_t::operator-(const uint128_t & rhs) const{
+UINT256_T_INLINE uint256_t uint256_t::operator-(const uint128_t & rhs) const{
     return *this - uint256_t(rhs);
 }
 
-uint256_t uint256_t::operator-(const uint256_t & rhs) const{
+#ifdef UINT256_T_LIMBS
+UINT256_T_INLINE uint256_t uint256_t::sub(const uint256_t & rhs) const{
+    uint256_t out;
+    uint64_t borrow = 0;
+    out.limb(0) = uint256_t_detail::subb64(limb(0), rhs.limb(0), borrow);
+    out.limb(1) = uint256_t_detail::subb64(limb(1), rhs.limb(1), borrow);
+    out.limb(2) = uint256_t_detail::subb64(limb(2), rhs.limb(2), borrow);
+    out.limb(3) = uint256_t_detail::subb64(limb(3), rhs.limb(3), borrow);
+    return out;
+}
+#else
+UINT256_T_INLINE uint256_t uint256_t::operator-(const uint256_t & rhs) const{
     return uint256_t(UPPER - rhs.UPPER - ((LOWER - rhs.LOWER) > LOWER), LOWER - rhs.LOWER);
 }
+#endif
 
-uint256_t & uint256_t::operator-=(const uint128_t & rhs){
+UINT256_T_INLINE uint256_t & uint256_t::operator-=(const uint128_t & rhs){
     return *this -= uint256_t(rhs);
 }
 
-uint256_t & uint256_t::operator-=(const uint256_t & rhs){
+UINT256_T_INLINE uint256_t & uint256_t::operator-=(const uint256_t & rhs){
+#ifdef UINT256_T_LIMBS
+    uint64_t borrow = 0;
+    limb(0) = uint256_t_detail::subb64(limb(0), rhs.limb(0), borrow);
+    limb(1) = uint256_t_detail::subb64(limb(1), rhs.limb(1), borrow);
+    limb(2) = uint256_t_detail::subb64(limb(2), rhs.limb(2), borrow);
+    limb(3) = uint256_t_detail::subb64(limb(3), rhs.limb(3), borrow);
+    return *this;
+#else
     *this = *this - rhs;
     return *this;
+#endif
 }
 
-uint256_t uint256_t::operator*(const uint128_t & rhs) const{
+UINT256_T_INLINE uint256_t uint256_t::operator*(const uint128_t & rhs) const{
     return *this * uint256_t(rhs);
 }
 
-uint256_t uint256_t::operator*(const uint256_t & rhs) const{
-    // split values into 4 64-bit parts
-    uint128_t top[4] = {UPPER.upper(), UPPER.lower(), LOWER.upper(), LOWER.lower()};
-    uint128_t bottom[4] = {rhs.upper().upper(), rhs.upper().lower(), rhs.lower().upper(), rhs.lower().lower()};
-    uint128_t products[4][4];
-
-    // multiply each component of the values
-    for(int y = 3; y > -1; y--){
-        for(int x = 3; x > -1; x--){
-            products[3 - y][x] = top[x] * bottom[y];
-        }
-    }
-
-    // first row
-    uint128_t fourth64 = uint128_t(products[0][3].lower());
-    uint128_t third64  = uint128_t(products[0][2].lower()) + uint128_t(products[0][3].upper());
-    uint128_t second64 = uint128_t(products[0][1].lower()) + uint128_t(products[0][2].upper());
-    uint128_t first64  = uint128_t(products[0][0].lower()) + uint128_t(products[0][1].upper());
-
-    // second row
-    third64  += uint128_t(products[1][3].lower());
-    second64 += uint128_t(products[1][2].lower()) + uint128_t(products[1][3].upper());
-    first64  += uint128_t(products[1][1].lower()) + uint128_t(products[1][2].upper());
-
-    // third row
-    second64 += uint128_t(products[2][3].lower());
-    first64  += uint128_t(products[2][2].lower()) + uint128_t(products[2][3].upper());
-
-    // fourth row
-    first64  += uint128_t(products[3][3].lower());
-
-    // combines the values, taking care of carry over
-    return uint256_t(first64 << uint128_64, uint128_0) +
-           uint256_t(third64.upper(), third64 << uint128_64) +
-           uint256_t(second64, uint128_0) +
-           uint256_t(fourth64);
+UINT256_T_INLINE uint256_t uint256_t::operator*(const uint256_t & rhs) const{
+    uint64_t a[4], b[4], r[4];
+    uint256_t_detail::to_limbs(*this, a);
+    uint256_t_detail::to_limbs(rhs, b);
+    uint256_t_detail::mul_limbs(a, b, r);
+    return uint256_t_detail::from_limbs(r);
 }
 
-uint256_t & uint256_t::operator*=(const uint128_t & rhs){
+UINT256_T_INLINE uint256_t & uint256_t::operator*=(const uint128_t & rhs){
     return *this *= uint256_t(rhs);
 }
 
-uint256_t & uint256_t::operator*=(const uint256_t & rhs){
+UINT256_T_INLINE uint256_t & uint256_t::operator*=(const uint256_t & rhs){
     *this = *this * rhs;
     return *this;
 }
 
-std::pair <uint256_t, uint256_t> uint256_t::divmod(const uint256_t & lhs, const uint256_t & rhs) const{
+#ifdef UINT256_T_LIMBS
+UINT256_T_INLINE uint256_t uint256_t::add_limb(const uint64_t rhs) const{
+    uint256_t out;
+    uint64_t carry = 0;
+    out.limb(0) = uint256_t_detail::addc64(limb(0), rhs, carry);
+    out.limb(1) = uint256_t_detail::addc64(limb(1), 0, carry);
+    out.limb(2) = uint256_t_detail::addc64(limb(2), 0, carry);
+    out.limb(3) = limb(3) + carry;
+    return out;
+}
+
+UINT256_T_INLINE uint256_t uint256_t::sub_limb(const uint64_t rhs) const{
+    uint256_t out;
+    uint64_t borrow = 0;
+    out.limb(0) = uint256_t_detail::subb64(limb(0), rhs, borrow);
+    out.limb(1) = uint256_t_detail::subb64(limb(1), 0, borrow);
+    out.limb(2) = uint256_t_detail::subb64(limb(2), 0, borrow);
+    out.limb(3) = limb(3) - borrow;
+    return out;
+}
+#endif
+
+// one row of the schoolbook multiplication: 3 full products and the lower
+// half of the top one, instead of the 10 products of mul_limbs
+UINT256_T_INLINE uint256_t uint256_t::mul_limb(const uint64_t rhs) const{
+    uint64_t a[4], r[4];
+    uint256_t_detail::to_limbs(*this, a);
+    uint64_t carry = 0;
+    for(int i = 0; i < 3; i++){
+        r[i] = 0;
+        carry = uint256_t_detail::mac64(r[i], a[i], rhs, carry);
+    }
+    r[3] = a[3] * rhs + carry;
+    return uint256_t_detail::from_limbs(r);
+}
+
+UINT256_T_INLINE std::pair <uint256_t, uint256_t> uint256_t::divmod(const uint256_t & lhs, const uint256_t & rhs) const{
     // Save some calculations /////////////////////
     if (rhs == uint256_0){
         throw std::domain_error("Error: division or modulus by 0");
@@ -383,105 +1591,224 @@ std::pair <uint256_t, uint256_t> uint256_t::divmod(const uint256_t & lhs, const
         return std::pair <uint256_t, uint256_t> (uint256_0, lhs);
     }
 
-    std::pair <uint256_t, uint256_t> qr(uint256_0, lhs);
-    uint256_t copyd = rhs << (lhs.bits() - rhs.bits());
-    uint256_t adder = uint256_1 << (lhs.bits() - rhs.bits());
-    if (copyd > qr.second){
-        copyd >>= uint256_1;
-        adder >>= uint256_1;
+    // Knuth, TAOCP Vol. 2, 4.3.1, Algorithm D over 64 bit digits
+    uint64_t u[4], v[4];
+    uint256_t_detail::to_limbs(lhs, u);
+    uint256_t_detail::to_limbs(rhs, v);
+
+    int m = 4;
+    while (!u[m - 1]){
+        m--;
+    }
+    int n = 4;
+    while (!v[n - 1]){
+        n--;
+    }
+
+    if (n == 1){
+        const std::pair <uint256_t, uint64_t> qr = divmod(lhs, v[0]);
+        return std::pair <uint256_t, uint256_t> (qr.first, uint256_t(qr.second));
     }
-    while (qr.second >= rhs){
-        if (qr.second >= copyd){
-            qr.second -= copyd;
-            qr.first |= adder;
+
+    uint64_t q[4] = {0, 0, 0, 0};
+    uint64_t r[4] = {0, 0, 0, 0};
+
+    // D1: normalize so that the top bit of the divisor is set
+    const unsigned int s = uint256_t_detail::clz64(v[n - 1]);
+    uint64_t vn[4];
+    uint64_t un[5];
+    for(int i = n - 1; i > 0; i--){
+        vn[i] = (v[i] << s) | (s?(v[i - 1] >> (64 - s)):0);
+    }
+    vn[0] = v[0] << s;
+
+    un[m] = s?(u[m - 1] >> (64 - s)):0;
+    for(int i = m - 1; i > 0; i--){
+        un[i] = (u[i] << s) | (s?(u[i - 1] >> (64 - s)):0);
+    }
+    un[0] = u[0] << s;
+
+    for(int j = m - n; j >= 0; j--){
+        // D3: estimate the quotient digit from the top two dividend digits
+        uint64_t qhat, rhat;
+        bool rhat_overflow = false;
+        if (un[j + n] >= vn[n - 1]){
+            qhat = (uint64_t) -1;
+            rhat = un[j + n - 1] + vn[n - 1];
+            rhat_overflow = (rhat < vn[n - 1]);
+        }
+        else{
+            qhat = uint256_t_detail::div128(un[j + n], un[j + n - 1], vn[n - 1], rhat);
+        }
+
+        // correct the estimate using the next divisor digit; at most twice
+        while (!rhat_overflow){
+            uint64_t p_hi;
+            const uint64_t p_lo = uint256_t_detail::mul64(qhat, vn[n - 2], p_hi);
+            if ((p_hi < rhat) || ((p_hi == rhat) && (p_lo <= un[j + n - 2]))){
+                break;
+            }
+            qhat--;
+            rhat += vn[n - 1];
+            rhat_overflow = (rhat < vn[n - 1]);
         }
-        copyd >>= uint256_1;
-        adder >>= uint256_1;
+
+        // D4: multiply and subtract
+        uint64_t borrow = 0;
+        uint64_t carry = 0;
+        for(int i = 0; i < n; i++){
+            uint64_t p_hi;
+            uint64_t p_lo = uint256_t_detail::mul64(qhat, vn[i], p_hi);
+            p_lo += carry;
+            p_hi += (p_lo < carry);
+            carry = p_hi;
+
+            const uint64_t t = un[i + j] - p_lo;
+            const uint64_t b = (un[i + j] < p_lo);
+            un[i + j] = t - borrow;
+            borrow = b | (t < borrow);
+        }
+        const uint64_t t = un[j + n] - carry;
+        const uint64_t b = (un[j + n] < carry);
+        un[j + n] = t - borrow;
+        borrow = b | (t < borrow);
+
+        // D5, D6: the estimate was one too large; add back
+        if (borrow){
+            qhat--;
+            carry = 0;
+            for(int i = 0; i < n; i++){
+                const uint64_t sum = un[i + j] + vn[i];
+                const uint64_t c = (sum < vn[i]);
+                un[i + j] = sum + carry;
+                carry = c | (un[i + j] < carry);
+            }
+            un[j + n] += carry;
+        }
+
+        q[j] = qhat;
+    }
+
+    // D8: unnormalize the remainder
+    for(int i = 0; i < n; i++){
+        r[i] = (un[i] >> s) | (s?(un[i + 1] << (64 - s)):0);
+    }
+
+    return std::pair <uint256_t, uint256_t> (uint256_t_detail::from_limbs(q), uint256_t_detail::from_limbs(r));
+}
+
+UINT256_T_INLINE std::pair <uint256_t, uint64_t> uint256_t::divmod(const uint256_t & lhs, const uint64_t & rhs) const{
+    if (!rhs){
+        throw std::domain_error("Error: division or modulus by 0");
     }
-    return qr;
+
+    uint64_t q[4];
+    uint256_t_detail::to_limbs(lhs, q);
+    const uint64_t r = uint256_t_detail::divmod_limb(q, rhs);
+    return std::pair <uint256_t, uint64_t> (uint256_t_detail::from_limbs(q), r);
 }
 
-uint256_t uint256_t::operator/(const uint128_t & rhs) const{
+UINT256_T_INLINE uint256_t uint256_t::operator/(const uint128_t & rhs) const{
     return *this / uint256_t(rhs);
 }
 
-uint256_t uint256_t::operator/(const uint256_t & rhs) const{
+UINT256_T_INLINE uint256_t uint256_t::operator/(const uint256_t & rhs) const{
     return divmod(*this, rhs).first;
 }
 
-uint256_t & uint256_t::operator/=(const uint128_t & rhs){
+UINT256_T_INLINE uint256_t & uint256_t::operator/=(const uint128_t & rhs){
     return *this /= uint256_t(rhs);
 }
 
-uint256_t & uint256_t::operator/=(const uint256_t & rhs){
+UINT256_T_INLINE uint256_t & uint256_t::operator/=(const uint256_t & rhs){
     *this = *this / rhs;
     return *this;
 }
 
-uint256_t uint256_t::operator%(const uint128_t & rhs) const{
+UINT256_T_INLINE uint256_t uint256_t::operator%(const uint128_t & rhs) const{
     return *this % uint256_t(rhs);
 }
 
-uint256_t uint256_t::operator%(const uint256_t & rhs) const{
+UINT256_T_INLINE uint256_t uint256_t::operator%(const uint256_t & rhs) const{
     return divmod(*this, rhs).second;
 }
 
-uint256_t & uint256_t::operator%=(const uint128_t & rhs){
+UINT256_T_INLINE uint256_t & uint256_t::operator%=(const uint128_t & rhs){
     return *this %= uint256_t(rhs);
 }
 
-uint256_t & uint256_t::operator%=(const uint256_t & rhs){
+UINT256_T_INLINE uint256_t & uint256_t::operator%=(const uint256_t & rhs){
     *this = *this % rhs;
     return *this;
 }
 
-uint256_t & uint256_t::operator++(){
+UINT256_T_INLINE uint256_t & uint256_t::operator++(){
     *this += uint256_1;
     return *this;
 }
 
-uint256_t uint256_t::operator++(int){
+UINT256_T_INLINE uint256_t uint256_t::operator++(int){
     uint256_t temp(*this);
     ++*this;
     return temp;
 }
 
-uint256_t & uint256_t::operator--(){
+UINT256_T_INLINE uint256_t & uint256_t::operator--(){
     *this -= uint256_1;
     return *this;
 }
 
-uint256_t uint256_t::operator--(int){
+UINT256_T_INLINE uint256_t uint256_t::operator--(int){
     uint256_t temp(*this);
     --*this;
     return temp;
 }
 
-uint256_t uint256_t::operator+() const{
+UINT256_T_INLINE uint256_t uint256_t::operator+() const{
     return *this;
 }
 
-uint256_t uint256_t::operator-() const{
+UINT256_T_INLINE uint256_t uint256_t::operator-() const{
+#ifdef UINT256_T_LIMBS
+    uint256_t out;
+    uint64_t borrow = 0;
+    out.limb(0) = uint256_t_detail::subb64(0, limb(0), borrow);
+    out.limb(1) = uint256_t_detail::subb64(0, limb(1), borrow);
+    out.limb(2) = uint256_t_detail::subb64(0, limb(2), borrow);
+    out.limb(3) = uint256_t_detail::subb64(0, limb(3), borrow);
+    return out;
+#else
     return ~*this + uint256_1;
+#endif
+}
+
+#ifdef UINT256_T_LIMBS
+UINT256_T_INLINE uint128_t uint256_t::upper() const {
+    return uint128_t(limb(3), limb(2));
 }
 
-const uint128_t & uint256_t::upper() const {
+UINT256_T_INLINE uint128_t uint256_t::lower() const {
+    return uint128_t(limb(1), limb(0));
+}
+#else
+UINT256_T_INLINE const uint128_t & uint256_t::upper() const {
     return UPPER;
 }
 
-const uint128_t & uint256_t::lower() const {
+UINT256_T_INLINE const uint128_t & uint256_t::lower() const {
     return LOWER;
 }
+#endif
 
-std::vector<uint8_t> uint256_t::export_bits() const {
+UINT256_T_INLINE std::vector<uint8_t> uint256_t::export_bits() const {
     std::vector<uint8_t> ret;
     ret.reserve(32);
-    UPPER.export_bits(ret);
-    LOWER.export_bits(ret);
+    upper().export_bits(ret);
+    lower().export_bits(ret);
     return ret;
 }
 
-std::vector<uint8_t> uint256_t::export_bits_truncate() const {
+UINT256_T_INLINE std::vector<uint8_t> uint256_t::export_bits_truncate() const {
     std::vector<uint8_t> ret = export_bits();
 
 	//prune the zeroes
@@ -492,236 +1819,1703 @@ std::vector<uint8_t> uint256_t::export_bits_truncate() const {
 	return ret;
 }
 
-uint16_t uint256_t::bits() const{
-    uint16_t out = 0;
-    if (UPPER){
-        out = 128;
-        uint128_t up = UPPER;
-        while (up){
-            up >>= uint128_1;
-            out++;
-        }
-    }
-    else{
-        uint128_t low = LOWER;
-        while (low){
-            low >>= uint128_1;
-            out++;
-        }
-    }
-    return out;
+UINT256_T_INLINE uint16_t uint256_t::bits() const{
+    return (uint16_t) bit_width(*this);
 }
 
-std::string uint256_t::str(uint8_t base, const unsigned int & len) const{
+UINT256_T_INLINE std::string uint256_t::str(uint8_t base, const unsigned int & len, const bool & uppercase) const{
     if ((base < 2) || (base > 36)){
         throw std::invalid_argument("Base must be in the range 2-36");
     }
-    std::string out = "";
-    if (!(*this)){
-        out = "0";
-    }
-    else{
-        std::pair <uint256_t, uint256_t> qr(*this, uint256_0);
-        do{
-            qr = divmod(qr.first, base);
-            out = "0123456789abcdefghijklmnopqrstuvwxyz"[(uint8_t) qr.second] + out;
-        } while (qr.first);
+
+    // base 2 has the most digits: one per bit
+    char buf[256];
+    char * const end = buf + sizeof(buf);
+    uint64_t limbs[4];
+    uint256_t_detail::to_limbs(*this, limbs);
+    const char * p = uint256_t_detail::format_limbs(end, limbs, base, uppercase?uint256_t_detail::upper_digits:uint256_t_detail::lower_digits);
+
+    const std::string::size_type size = end - p;
+    if (size < len){
+        std::string out(len, '0');
+        out.replace(len - size, size, p, size);
+        return out;
     }
-    if (out.size() < len){
-        out = std::string(len - out.size(), '0') + out;
+    return std::string(p, size);
+}
+
+UINT256_T_INLINE std::pair <uint256_t, uint256_t> mul_wide(const uint256_t & lhs, const uint256_t & rhs){
+    uint64_t a[4], b[4], r[8];
+    uint256_t_detail::to_limbs(lhs, a);
+    uint256_t_detail::to_limbs(rhs, b);
+    uint256_t_detail::mul_limbs_wide(a, b, r);
+    return std::pair <uint256_t, uint256_t> (uint256_t_detail::from_limbs(r + 4), uint256_t_detail::from_limbs(r));
+}
+
+UINT256_T_INLINE uint256_t mulhi(const uint256_t & lhs, const uint256_t & rhs){
+    uint64_t a[4], b[4], r[8];
+    uint256_t_detail::to_limbs(lhs, a);
+    uint256_t_detail::to_limbs(rhs, b);
+    uint256_t_detail::mul_limbs_wide(a, b, r);
+    return uint256_t_detail::from_limbs(r + 4);
+}
+
+UINT256_T_INLINE bool add_overflow(const uint256_t & lhs, const uint256_t & rhs, uint256_t & result){
+    uint64_t a[4], b[4], r[4];
+    uint256_t_detail::to_limbs(lhs, a);
+    uint256_t_detail::to_limbs(rhs, b);
+    uint64_t carry = 0;
+    r[0] = uint256_t_detail::addc64(a[0], b[0], carry);
+    r[1] = uint256_t_detail::addc64(a[1], b[1], carry);
+    r[2] = uint256_t_detail::addc64(a[2], b[2], carry);
+    r[3] = uint256_t_detail::addc64(a[3], b[3], carry);
+    result = uint256_t_detail::from_limbs(r);
+    return carry;
+}
+
+UINT256_T_INLINE bool sub_overflow(const uint256_t & lhs, const uint256_t & rhs, uint256_t & result){
+    uint64_t a[4], b[4], r[4];
+    uint256_t_detail::to_limbs(lhs, a);
+    uint256_t_detail::to_limbs(rhs, b);
+    uint64_t borrow = 0;
+    r[0] = uint256_t_detail::subb64(a[0], b[0], borrow);
+    r[1] = uint256_t_detail::subb64(a[1], b[1], borrow);
+    r[2] = uint256_t_detail::subb64(a[2], b[2], borrow);
+    r[3] = uint256_t_detail::subb64(a[3], b[3], borrow);
+    result = uint256_t_detail::from_limbs(r);
+    return borrow;
+}
+
+UINT256_T_INLINE bool mul_overflow(const uint256_t & lhs, const uint256_t & rhs, uint256_t & result){
+    uint64_t a[4], b[4], r[8];
+    uint256_t_detail::to_limbs(lhs, a);
+    uint256_t_detail::to_limbs(rhs, b);
+
+    // 2^(m - 1) * 2^(n - 1) <= lhs * rhs < 2^(m + n), so only m + n == 257
+    // needs the upper half of the product
+    const int width = bit_width(lhs) + bit_width(rhs);
+    if (width != 257){
+        uint256_t_detail::mul_limbs(a, b, r);
+        result = uint256_t_detail::from_limbs(r);
+        return width > 257;
     }
-    return out;
+    uint256_t_detail::mul_limbs_wide(a, b, r);
+    result = uint256_t_detail::from_limbs(r);
+    return r[4] | r[5] | r[6] | r[7];
 }
 
-uint256_t operator&(const uint128_t & lhs, const uint256_t & rhs){
-    return rhs & lhs;
+UINT256_T_INLINE uint256_t add_sat(const uint256_t & lhs, const uint256_t & rhs){
+    uint256_t result;
+    return add_overflow(lhs, rhs, result)?uint256_max:result;
 }
 
-uint128_t & operator&=(uint128_t & lhs, const uint256_t & rhs){
-    lhs = (rhs & lhs).lower();
-    return lhs;
+UINT256_T_INLINE uint256_t sub_sat(const uint256_t & lhs, const uint256_t & rhs){
+    uint256_t result;
+    return sub_overflow(lhs, rhs, result)?uint256_0:result;
 }
 
-uint256_t operator|(const uint128_t & lhs, const uint256_t & rhs){
-    return rhs | lhs;
+UINT256_T_INLINE uint256_t mul_sat(const uint256_t & lhs, const uint256_t & rhs){
+    uint256_t result;
+    return mul_overflow(lhs, rhs, result)?uint256_max:result;
 }
 
-uint128_t & operator|=(uint128_t & lhs, const uint256_t & rhs){
-    lhs = (rhs | lhs).lower();
-    return lhs;
+UINT256_T_INLINE int countl_zero(const uint256_t & value){
+    uint64_t limbs[4];
+    uint256_t_detail::to_limbs(value, limbs);
+    for(int i = 3; i >= 0; i--){
+        if (limbs[i]){
+            return 64 * (3 - i) + uint256_t_detail::clz64(limbs[i]);
+        }
+    }
+    return 256;
 }
 
-uint256_t operator^(const uint128_t & lhs, const uint256_t & rhs){
-    return rhs ^ lhs;
+UINT256_T_INLINE int countr_zero(const uint256_t & value){
+    uint64_t limbs[4];
+    uint256_t_detail::to_limbs(value, limbs);
+    for(int i = 0; i < 4; i++){
+        if (limbs[i]){
+            return 64 * i + uint256_t_detail::ctz64(limbs[i]);
+        }
+    }
+    return 256;
 }
 
-uint128_t & operator^=(uint128_t & lhs, const uint256_t & rhs){
-    lhs = (rhs ^ lhs).lower();
-    return lhs;
+UINT256_T_INLINE int popcount(const uint256_t & value){
+    uint64_t limbs[4];
+    uint256_t_detail::to_limbs(value, limbs);
+    return uint256_t_detail::popcount64(limbs[0]) + uint256_t_detail::popcount64(limbs[1]) + uint256_t_detail::popcount64(limbs[2]) + uint256_t_detail::popcount64(limbs[3]);
 }
 
-uint256_t operator<<(const bool & lhs, const uint256_t & rhs){
-    return uint256_t(lhs) << rhs;
+UINT256_T_INLINE int bit_width(const uint256_t & value){
+    return 256 - countl_zero(value);
 }
 
-uint256_t operator<<(const uint8_t & lhs, const uint256_t & rhs){
-    return uint256_t(lhs) << rhs;
+UINT256_T_INLINE bool has_single_bit(const uint256_t & value){
+    return popcount(value) == 1;
 }
 
-uint256_t operator<<(const uint16_t & lhs, const uint256_t & rhs){
-    return uint256_t(lhs) << rhs;
+UINT256_T_INLINE uint256_t rotl(const uint256_t & value, const int shift){
+    // shift % 256, where negative shifts rotate right
+    const unsigned int r = (unsigned int) shift & 255;
+    uint64_t x[4];
+    uint256_t_detail::to_limbs(value, x);
+    uint64_t x0 = x[0], x1 = x[1], x2 = x[2], x3 = x[3];
+    if (r & 128){
+        std::swap(x0, x2);
+        std::swap(x1, x3);
+    }
+    if (r & 64){
+        const uint64_t t = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+        x0 = t;
+    }
+    const unsigned int bits = r & 63;
+    if (bits){
+        const uint64_t t = x3;
+        x3 = (x3 << bits) | (x2 >> (64 - bits));
+        x2 = (x2 << bits) | (x1 >> (64 - bits));
+        x1 = (x1 << bits) | (x0 >> (64 - bits));
+        x0 = (x0 << bits) | (t  >> (64 - bits));
+    }
+    return uint256_t(x3, x2, x1, x0);
 }
 
-uint256_t operator<<(const uint32_t & lhs, const uint256_t & rhs){
-    return uint256_t(lhs) << rhs;
+UINT256_T_INLINE uint256_t rotr(const uint256_t & value, const int shift){
+    return rotl(value, (int) (0u - ((unsigned int) shift & 255)));
 }
 
-uint256_t operator<<(const uint64_t & lhs, const uint256_t & rhs){
-    return uint256_t(lhs) << rhs;
-}
+// Batch operations
+// Each vector kernel below works on whole values held in one register: one
+// per __m256i, two per __m512i. Carries and borrows between the limbs of a
+// value are found from per limb masks instead of a serial chain.
+UINT256_T_DETAIL_BEGIN
+#if defined(UINT256_T_HAS_AVX512) || defined(UINT256_T_HAS_AVX2)
+    // limbs that receive a carry, from the limbs that generate one and the
+    // limbs that pass an incoming one on (all ones for add, 0 for subtract)
+    // Adding the masks ripples each carry through the limbs that pass it on.
+    UINT256_T_INLINE unsigned int carries4(const unsigned int generate, const unsigned int propagate){
+        return ((((generate << 1) & 0xe) + propagate) ^ propagate) & 0xf;
+    }
+#endif
+
+#if defined(UINT256_T_HAS_AVX512)
+    typedef __m512i batch_vector;
+    UINT256_T_INLINE_VAR const std::size_t BATCH_WIDTH = 2;
+
+    UINT256_T_INLINE batch_vector batch_load(const uint256_t * p){
+        return _mm512_loadu_si512(p);
+    }
+
+    UINT256_T_INLINE void batch_store(uint256_t * p, const batch_vector v){
+        _mm512_storeu_si512(p, v);
+    }
+
+    // the two values in a register do not carry into each other
+    UINT256_T_INLINE __mmask8 batch_carries(const unsigned int generate, const unsigned int propagate){
+        return (__mmask8) (carries4(generate & 0xf, propagate & 0xf) | (carries4(generate >> 4, propagate >> 4) << 4));
+    }
+
+    struct batch_add{
+        static batch_vector vector(const batch_vector a, const batch_vector b){
+            const batch_vector ones = _mm512_set1_epi64(-1);
+            const batch_vector sum = _mm512_add_epi64(a, b);
+            const __mmask8 carry = batch_carries(_mm512_cmplt_epu64_mask(sum, a), _mm512_cmpeq_epi64_mask(sum, ones));
+            return _mm512_mask_sub_epi64(sum, carry, sum, ones);
+        }
+        static uint256_t scalar(const uint256_t & a, const uint256_t & b){
+            return a + b;
+        }
+    };
+
+    struct batch_sub{
+        static batch_vector vector(const batch_vector a, const batch_vector b){
+            const batch_vector diff = _mm512_sub_epi64(a, b);
+            const __mmask8 borrow = batch_carries(_mm512_cmplt_epu64_mask(a, b), _mm512_cmpeq_epi64_mask(diff, _mm512_setzero_si512()));
+            return _mm512_mask_add_epi64(diff, borrow, diff, _mm512_set1_epi64(-1));
+        }
+        static uint256_t scalar(const uint256_t & a, const uint256_t & b){
+            return a - b;
+        }
+    };
+
+    struct batch_and{
+        static batch_vector vector(const batch_vector a, const batch_vector b){
+            return _mm512_and_si512(a, b);
+        }
+        static uint256_t scalar(const uint256_t & a, const uint256_t & b){
+            return a & b;
+        }
+    };
+
+    struct batch_or{
+        static batch_vector vector(const batch_vector a, const batch_vector b){
+            return _mm512_or_si512(a, b);
+        }
+        static uint256_t scalar(const uint256_t & a, const uint256_t & b){
+            return a | b;
+        }
+    };
+
+    struct batch_xor{
+        static batch_vector vector(const batch_vector a, const batch_vector b){
+            return _mm512_xor_si512(a, b);
+        }
+        static uint256_t scalar(const uint256_t & a, const uint256_t & b){
+            return a ^ b;
+        }
+    };
+
+    // the highest limb that differs decides, so comparing the masks of
+    // limbs that are less and greater as numbers compares the values
+    struct batch_lt{
+        static void vector(const batch_vector a, const batch_vector b, uint64_t mask[2]){
+            const unsigned int lt = _mm512_cmplt_epu64_mask(a, b);
+            const unsigned int gt = _mm512_cmpgt_epu64_mask(a, b);
+            mask[0] = (uint64_t) 0 - (uint64_t) ((lt & 0xf) > (gt & 0xf));
+            mask[1] = (uint64_t) 0 - (uint64_t) ((lt >> 4) > (gt >> 4));
+        }
+        static uint64_t scalar(const uint256_t & a, const uint256_t & b){
+            return (uint64_t) 0 - (uint64_t) (a < b);
+        }
+    };
+
+    struct batch_eq{
+        static void vector(const batch_vector a, const batch_vector b, uint64_t mask[2]){
+            const unsigned int eq = _mm512_cmpeq_epi64_mask(a, b);
+            mask[0] = (uint64_t) 0 - (uint64_t) ((eq & 0xf) == 0xf);
+            mask[1] = (uint64_t) 0 - (uint64_t) ((eq >> 4) == 0xf);
+        }
+        static uint64_t scalar(const uint256_t & a, const uint256_t & b){
+            return (uint64_t) 0 - (uint64_t) (a == b);
+        }
+    };
+#elif defined(UINT256_T_HAS_AVX2)
+    typedef __m256i batch_vector;
+    UINT256_T_INLINE_VAR const std::size_t BATCH_WIDTH = 1;
+
+    UINT256_T_INLINE batch_vector batch_load(const uint256_t * p){
+        return _mm256_loadu_si256(reinterpret_cast <const __m256i *> (p));
+    }
+
+    UINT256_T_INLINE void batch_store(uint256_t * p, const batch_vector v){
+        _mm256_storeu_si256(reinterpret_cast <__m256i *> (p), v);
+    }
+
+    UINT256_T_INLINE unsigned int batch_bits(const batch_vector v){
+        return (unsigned int) _mm256_movemask_pd(_mm256_castsi256_pd(v));
+    }
+
+    // AVX2 only compares signed limbs, so flip the sign bits first
+    UINT256_T_INLINE unsigned int batch_lt_bits(const batch_vector a, const batch_vector b){
+        const batch_vector sign = _mm256_set1_epi64x((long long) 0x8000000000000000ULL);
+        return batch_bits(_mm256_cmpgt_epi64(_mm256_xor_si256(b, sign), _mm256_xor_si256(a, sign)));
+    }
+
+    // all ones in the limbs whose bit is set in bits
+    UINT256_T_INLINE batch_vector batch_expand(const unsigned int bits){
+        const batch_vector select = _mm256_set_epi64x(8, 4, 2, 1);
+        return _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(bits), select), select);
+    }
+
+    struct batch_add{
+        static batch_vector vector(const batch_vector a, const batch_vector b){
+            const batch_vector sum = _mm256_add_epi64(a, b);
+            const unsigned int carry = carries4(batch_lt_bits(sum, a), batch_bits(_mm256_cmpeq_epi64(sum, _mm256_set1_epi64x(-1))));
+            return _mm256_sub_epi64(sum, batch_expand(carry));
+        }
+        static uint256_t scalar(const uint256_t & a, const uint256_t & b){
+            return a + b;
+        }
+    };
+
+    struct batch_sub{
+        static batch_vector vector(const batch_vector a, const batch_vector b){
+            const batch_vector diff = _mm256_sub_epi64(a, b);
+            const unsigned int borrow = carries4(batch_lt_bits(a, b), batch_bits(_mm256_cmpeq_epi64(diff, _mm256_setzero_si256())));
+            return _mm256_add_epi64(diff, batch_expand(borrow));
+        }
+        static uint256_t scalar(const uint256_t & a, const uint256_t & b){
+            return a - b;
+        }
+    };
+
+    struct batch_and{
+        static batch_vector vector(const batch_vector a, const batch_vector b){
+            return _mm256_and_si256(a, b);
+        }
+        static uint256_t scalar(const uint256_t & a, const uint256_t & b){
+            return a & b;
+        }
+    };
+
+    struct batch_or{
+        static batch_vector vector(const batch_vector a, const batch_vector b){
+            return _mm256_or_si256(a, b);
+        }
+        static uint256_t scalar(const uint256_t & a, const uint256_t & b){
+            return a | b;
+        }
+    };
+
+    struct batch_xor{
+        static batch_vector vector(const batch_vector a, const batch_vector b){
+            return _mm256_xor_si256(a, b);
+        }
+        static uint256_t scalar(const uint256_t & a, const uint256_t & b){
+            return a ^ b;
+        }
+    };
+
+    // the highest limb that differs decides, so comparing the masks of
+    // limbs that are less and greater as numbers compares the values
+    struct batch_lt{
+        static void vector(const batch_vector a, const batch_vector b, uint64_t mask[1]){
+            mask[0] = (uint64_t) 0 - (uint64_t) (batch_lt_bits(a, b) > batch_lt_bits(b, a));
+        }
+        static uint64_t scalar(const uint256_t & a, const uint256_t & b){
+            return (uint64_t) 0 - (uint64_t) (a < b);
+        }
+    };
+
+    struct batch_eq{
+        static void vector(const batch_vector a, const batch_vector b, uint64_t mask[1]){
+            mask[0] = (uint64_t) 0 - (uint64_t) (batch_bits(_mm256_cmpeq_epi64(a, b)) == 0xf);
+        }
+        static uint64_t scalar(const uint256_t & a, const uint256_t & b){
+            return (uint64_t) 0 - (uint64_t) (a == b);
+        }
+    };
+#else
+    struct batch_add{
+        static uint256_t scalar(const uint256_t & a, const uint256_t & b){
+            return a + b;
+        }
+    };
+
+    struct batch_sub{
+        static uint256_t scalar(const uint256_t & a, const uint256_t & b){
+            return a - b;
+        }
+    };
+
+    struct batch_and{
+        static uint256_t scalar(const uint256_t & a, const uint256_t & b){
+            return a & b;
+        }
+    };
+
+    struct batch_or{
+        static uint256_t scalar(const uint256_t & a, const uint256_t & b){
+            return a | b;
+        }
+    };
+
+    struct batch_xor{
+        static uint256_t scalar(const uint256_t & a, const uint256_t & b){
+            return a ^ b;
+        }
+    };
+
+    struct batch_lt{
+        static uint64_t scalar(const uint256_t & a, const uint256_t & b){
+            return (uint64_t) 0 - (uint64_t) (a < b);
+        }
+    };
+
+    struct batch_eq{
+        static uint64_t scalar(const uint256_t & a, const uint256_t & b){
+            return (uint64_t) 0 - (uint64_t) (a == b);
+        }
+    };
+#endif
+
+    template <typename Op>
+    UINT256_T_INLINE void batch_values(const uint256_t * lhs, const uint256_t * rhs, uint256_t * out, const std::size_t n){
+        std::size_t i = 0;
+#if defined(UINT256_T_HAS_AVX512) || defined(UINT256_T_HAS_AVX2)
+        for(; i + BATCH_WIDTH <= n; i += BATCH_WIDTH){
+            batch_store(out + i, Op::vector(batch_load(lhs + i), batch_load(rhs + i)));
+        }
+#endif
+        for(; i < n; i++){
+            out[i] = Op::scalar(lhs[i], rhs[i]);
+        }
+    }
+
+    template <typename Op>
+    UINT256_T_INLINE void batch_masks(const uint256_t * lhs, const uint256_t * rhs, uint64_t * mask, const std::size_t n){
+        std::size_t i = 0;
+#if defined(UINT256_T_HAS_AVX512) || defined(UINT256_T_HAS_AVX2)
+        for(; i + BATCH_WIDTH <= n; i += BATCH_WIDTH){
+            Op::vector(batch_load(lhs + i), batch_load(rhs + i), mask + i);
+        }
+#endif
+        for(; i < n; i++){
+            mask[i] = Op::scalar(lhs[i], rhs[i]);
+        }
+    }
+UINT256_T_DETAIL_END
+
+UINT256_T_INLINE void add_n(const uint256_t * lhs, const uint256_t * rhs, uint256_t * out, const std::size_t n){
+    uint256_t_detail::batch_values <uint256_t_detail::batch_add> (lhs, rhs, out, n);
+}
+
+UINT256_T_INLINE void sub_n(const uint256_t * lhs, const uint256_t * rhs, uint256_t * out, const std::size_t n){
+    uint256_t_detail::batch_values <uint256_t_detail::batch_sub> (lhs, rhs, out, n);
+}
+
+UINT256_T_INLINE void and_n(const uint256_t * lhs, const uint256_t * rhs, uint256_t * out, const std::size_t n){
+    uint256_t_detail::batch_values <uint256_t_detail::batch_and> (lhs, rhs, out, n);
+}
+
+UINT256_T_INLINE void or_n(const uint256_t * lhs, const uint256_t * rhs, uint256_t * out, const std::size_t n){
+    uint256_t_detail::batch_values <uint256_t_detail::batch_or> (lhs, rhs, out, n);
+}
+
+UINT256_T_INLINE void xor_n(const uint256_t * lhs, const uint256_t * rhs, uint256_t * out, const std::size_t n){
+    uint256_t_detail::batch_values <uint256_t_detail::batch_xor> (lhs, rhs, out, n);
+}
+
+UINT256_T_INLINE void lt_n(const uint256_t * lhs, const uint256_t * rhs, uint64_t * mask, const std::size_t n){
+    uint256_t_detail::batch_masks <uint256_t_detail::batch_lt> (lhs, rhs, mask, n);
+}
+
+UINT256_T_INLINE void eq_n(const uint256_t * lhs, const uint256_t * rhs, uint64_t * mask, const std::size_t n){
+    uint256_t_detail::batch_masks <uint256_t_detail::batch_eq> (lhs, rhs, mask, n);
+}
+
+namespace uint256_t_detail{
+    UINT256_T_INLINE void montgomery_mul(uint64_t r[4], const uint64_t a[4], const uint64_t b[4], const uint64_t m[4], const uint64_t ninv){
+        uint64_t t[8];
+        mul_limbs_wide(a, b, t);
+        montgomery_reduce(r, t, m, ninv);
+    }
+
+    UINT256_T_INLINE void montgomery_sqr(uint64_t r[4], const uint64_t a[4], const uint64_t m[4], const uint64_t ninv){
+        uint64_t t[8];
+        sqr_limbs_wide(a, t);
+        montgomery_reduce(r, t, m, ninv);
+    }
+
+    UINT256_T_INLINE void montgomery_redc(uint64_t r[4], const uint64_t a[4], const uint64_t m[4], const uint64_t ninv){
+        uint64_t t[8] = {a[0], a[1], a[2], a[3], 0, 0, 0, 0};
+        montgomery_reduce(r, t, m, ninv);
+    }
+
+    UINT256_T_INLINE void add_mod(uint64_t r[4], const uint64_t a[4], const uint64_t b[4], const uint64_t m[4]){
+        uint64_t carry = 0, borrow = 0;
+        const uint64_t s0 = addc64(a[0], b[0], carry);
+        const uint64_t s1 = addc64(a[1], b[1], carry);
+        const uint64_t s2 = addc64(a[2], b[2], carry);
+        const uint64_t s3 = addc64(a[3], b[3], carry);
+        const uint64_t d0 = subb64(s0, m[0], borrow);
+        const uint64_t d1 = subb64(s1, m[1], borrow);
+        const uint64_t d2 = subb64(s2, m[2], borrow);
+        const uint64_t d3 = subb64(s3, m[3], borrow);
+
+        // a + b - m is the answer unless it went negative
+        const uint64_t keep = 0 - (uint64_t) (carry >= borrow);
+        r[0] = (d0 & keep) | (s0 & ~keep);
+        r[1] = (d1 & keep) | (s1 & ~keep);
+        r[2] = (d2 & keep) | (s2 & ~keep);
+        r[3] = (d3 & keep) | (s3 & ~keep);
+    }
+
+    UINT256_T_INLINE void sub_mod(uint64_t r[4], const uint64_t a[4], const uint64_t b[4], const uint64_t m[4]){
+        uint64_t borrow = 0, carry = 0;
+        const uint64_t d0 = subb64(a[0], b[0], borrow);
+        const uint64_t d1 = subb64(a[1], b[1], borrow);
+        const uint64_t d2 = subb64(a[2], b[2], borrow);
+        const uint64_t d3 = subb64(a[3], b[3], borrow);
+
+        // add m back if a - b went negative
+        const uint64_t mask = 0 - borrow;
+        const uint64_t m0 = m[0] & mask, m1 = m[1] & mask, m2 = m[2] & mask, m3 = m[3] & mask;
+        r[0] = addc64(d0, m0, carry);
+        r[1] = addc64(d1, m1, carry);
+        r[2] = addc64(d2, m2, carry);
+        r[3] = addc64(d3, m3, carry);
+    }
+}
+
+UINT256_T_INLINE uint256_divider::uint256_divider(const uint256_t & d)
+    : divisor(d)
+{
+    if (!d){
+        throw std::domain_error("Error: division or modulus by 0");
+    }
+
+    uint64_t limbs[4];
+    uint256_t_detail::to_limbs(d, limbs);
+
+    size = 4;
+    while (!limbs[size - 1]){
+        size--;
+    }
+
+    shift = uint256_t_detail::clz64(limbs[size - 1]);
+    for(int i = 3; i > 0; i--){
+        normalized[i] = (limbs[i] << shift) | (shift?(limbs[i - 1] >> (64 - shift)):0);
+    }
+    normalized[0] = limbs[0] << shift;
+
+    if (size == 1){
+        reciprocal = uint256_t_detail::reciprocal_2by1(normalized[0]);
+    }
+    else{
+        reciprocal = uint256_t_detail::reciprocal_3by2(normalized[size - 1], normalized[size - 2]);
+    }
+
+    // divisibility by multiplying with the inverse of the odd part
+    // Granlund and Montgomery, "Division by invariant integers using multiplication" (1994)
+    int i = 0;
+    while (!limbs[i]){
+        i++;
+    }
+    trailing = 64 * i + uint256_t_detail::ctz64(limbs[i]);
+
+    const uint256_t odd = d >> trailing;
+    inverse = odd;                              // correct to 3 bits
+    for(int bits = 3; bits < 256; bits *= 2){
+        inverse *= uint256_t(2) - odd * inverse; // Newton's method doubles the correct bits
+    }
+    limit = uint256_max / odd;
+}
+
+UINT256_T_INLINE const uint256_t & uint256_divider::value() const{
+    return divisor;
+}
+
+UINT256_T_INLINE std::pair <uint256_t, uint256_t> uint256_divider::divmod(const uint256_t & numerator) const{
+    if (numerator < divisor){
+        return std::pair <uint256_t, uint256_t> (uint256_0, numerator);
+    }
+
+    uint64_t u[4];
+    uint256_t_detail::to_limbs(numerator, u);
+
+    // normalize the numerator by the same amount as the divisor
+    uint64_t un[5];
+    un[4] = shift?(u[3] >> (64 - shift)):0;
+    for(int i = 3; i > 0; i--){
+        un[i] = (u[i] << shift) | (shift?(u[i - 1] >> (64 - shift)):0);
+    }
+    un[0] = u[0] << shift;
+
+    uint64_t q[4] = {0, 0, 0, 0};
+    uint64_t r[4] = {0, 0, 0, 0};
+
+    if (size == 1){
+        uint64_t rem = un[4];
+        for(int j = 3; j >= 0; j--){
+            q[j] = uint256_t_detail::div2by1(rem, un[j], normalized[0], reciprocal, rem);
+        }
+        r[0] = rem >> shift;
+        return std::pair <uint256_t, uint256_t> (uint256_t_detail::from_limbs(q), uint256_t_detail::from_limbs(r));
+    }
+
+    const int n = size;
+    const uint64_t d1 = normalized[n - 1];
+    const uint64_t d0 = normalized[n - 2];
+    for(int j = 4 - n; j >= 0; j--){
+        uint64_t qhat;
+        if ((un[j + n] == d1) && (un[j + n - 1] == d0)){
+            qhat = (uint64_t) -1;
+            const uint64_t borrow = uint256_t_detail::submul(un + j, normalized, n, qhat);
+            const uint64_t top = un[j + n];
+            un[j + n] = top - borrow;
+            if (top < borrow){
+                qhat--;
+                un[j + n] += uint256_t_detail::addback(un + j, normalized, n);
+            }
+        }
+        else{
+            // the top three limbs give the quotient limb; the rest only borrow
+            uint64_t r1, r0;
+            qhat = uint256_t_detail::div3by2(un[j + n], un[j + n - 1], un[j + n - 2], d1, d0, reciprocal, r1, r0);
+
+            uint64_t borrow = uint256_t_detail::submul(un + j, normalized, n - 2, qhat);
+            const uint64_t borrow0 = (r0 < borrow);
+            r0 -= borrow;
+            borrow = (r1 < borrow0);
+            r1 -= borrow0;
+
+            un[j + n - 2] = r0;
+            un[j + n - 1] = r1;
+            un[j + n] = 0;
+            if (borrow){
+                qhat--;
+                un[j + n - 1] += d1 + uint256_t_detail::addback(un + j, normalized, n - 1);
+            }
+        }
+        q[j] = qhat;
+    }
+
+    for(int i = 0; i < n; i++){
+        r[i] = (un[i] >> shift) | (shift?(un[i + 1] << (64 - shift)):0);
+    }
+
+    return std::pair <uint256_t, uint256_t> (uint256_t_detail::from_limbs(q), uint256_t_detail::from_limbs(r));
+}
+
+UINT256_T_INLINE uint256_t uint256_divider::quotient(const uint256_t & numerator) const{
+    return divmod(numerator).first;
+}
+
+UINT256_T_INLINE uint256_t uint256_divider::remainder(const uint256_t & numerator) const{
+    return divmod(numerator).second;
+}
+
+UINT256_T_INLINE bool uint256_divider::divides(const uint256_t & numerator) const{
+    if (trailing && (bool) (numerator << (256 - trailing))){
+        return false;
+    }
+    return ((numerator >> trailing) * inverse) <= limit;
+}
+
+UINT256_T_INLINE uint256_t operator/(const uint256_t & lhs, const uint256_divider & rhs){
+    return rhs.quotient(lhs);
+}
+
+UINT256_T_INLINE uint256_t & operator/=(uint256_t & lhs, const uint256_divider & rhs){
+    return lhs = rhs.quotient(lhs);
+}
+
+UINT256_T_INLINE uint256_t operator%(const uint256_t & lhs, const uint256_divider & rhs){
+    return rhs.remainder(lhs);
+}
+
+UINT256_T_INLINE uint256_t & operator%=(uint256_t & lhs, const uint256_divider & rhs){
+    return lhs = rhs.remainder(lhs);
+}
+
+UINT256_T_INLINE barrett_context::barrett_context(const uint256_t & modulus)
+    : mod(modulus)
+{
+    if (!modulus){
+        throw std::domain_error("Error: division or modulus by 0");
+    }
+
+    uint64_t limbs[4];
+    uint256_t_detail::to_limbs(modulus, limbs);
+    int top = 3;
+    while (!limbs[top]){
+        top--;
+    }
+    shift = 64 * (3 - top) + uint256_t_detail::clz64(limbs[top]);
+
+    const uint256_t n = modulus << shift;
+    uint256_t_detail::to_limbs(n, normalized);
+
+    // floor((2^512 - 1) / n) - 2^256, one bit at a time
+    // the remainder starts as the part of 2^512 - 1 above the lower 256 bits, less n
+    uint256_t rem = ~n;
+    uint256_t quotient = 0;
+    for(int i = 0; i < 256; i++){
+        const bool carry = rem.upper().upper() >> 63;
+        rem = (rem << 1) | 1;
+        quotient <<= 1;
+        if (carry || (rem >= n)){
+            rem -= n;
+            quotient |= 1;
+        }
+    }
+    uint256_t_detail::to_limbs(quotient, mu);
+}
+
+UINT256_T_INLINE const uint256_t & barrett_context::modulus() const{
+    return mod;
+}
+
+UINT256_T_INLINE void barrett_context::reduce_limbs(uint64_t r[4], const uint64_t x[8]) const{
+    // the upper half has to be reduced first for the quotient estimate to hold
+    uint64_t m[4], borrow = 0;
+    uint256_t_detail::to_limbs(mod, m);
+    uint256_t_detail::subb64(x[4], m[0], borrow);
+    uint256_t_detail::subb64(x[5], m[1], borrow);
+    uint256_t_detail::subb64(x[6], m[2], borrow);
+    uint256_t_detail::subb64(x[7], m[3], borrow);
+    if (!borrow){
+        const uint64_t upper[8] = {x[4], x[5], x[6], x[7], 0, 0, 0, 0};
+        uint64_t t[8] = {x[0], x[1], x[2], x[3], 0, 0, 0, 0};
+        uint256_t_detail::barrett_reduce(t + 4, upper, normalized, mu, shift);
+        uint256_t_detail::barrett_reduce(r, t, normalized, mu, shift);
+    }
+    else{
+        uint256_t_detail::barrett_reduce(r, x, normalized, mu, shift);
+    }
+}
+
+UINT256_T_INLINE uint256_t barrett_context::reduce(const uint256_t & upper, const uint256_t & lower) const{
+    uint64_t x[8], r[4];
+    uint256_t_detail::to_limbs(lower, x);
+    uint256_t_detail::to_limbs(upper, x + 4);
+    reduce_limbs(r, x);
+    return uint256_t_detail::from_limbs(r);
+}
+
+UINT256_T_INLINE uint256_t barrett_context::reduce(const std::pair <uint256_t, uint256_t> & value) const{
+    return reduce(value.first, value.second);
+}
+
+UINT256_T_INLINE uint256_t barrett_context::reduce(const uint256_t & value) const{
+    uint64_t x[8] = {0, 0, 0, 0, 0, 0, 0, 0}, r[4];
+    uint256_t_detail::to_limbs(value, x);
+    uint256_t_detail::barrett_reduce(r, x, normalized, mu, shift);
+    return uint256_t_detail::from_limbs(r);
+}
+
+UINT256_T_INLINE uint256_t barrett_context::mulmod(const uint256_t & lhs, const uint256_t & rhs) const{
+    uint64_t a[4], b[4], x[8], r[4];
+    uint256_t_detail::to_limbs(lhs, a);
+    uint256_t_detail::to_limbs(rhs, b);
+    uint256_t_detail::mul_limbs_wide(a, b, x);
+    reduce_limbs(r, x);
+    return uint256_t_detail::from_limbs(r);
+}
+
+UINT256_T_INLINE uint256_t barrett_context::addmod(const uint256_t & lhs, const uint256_t & rhs) const{
+    uint64_t a[4], b[4], m[4], r[4];
+    uint256_t_detail::to_limbs(lhs, a);
+    uint256_t_detail::to_limbs(rhs, b);
+    uint256_t_detail::to_limbs(mod, m);
+    uint256_t_detail::add_mod(r, a, b, m);
+    return uint256_t_detail::from_limbs(r);
+}
+
+UINT256_T_INLINE uint256_t barrett_context::submod(const uint256_t & lhs, const uint256_t & rhs) const{
+    uint64_t a[4], b[4], m[4], r[4];
+    uint256_t_detail::to_limbs(lhs, a);
+    uint256_t_detail::to_limbs(rhs, b);
+    uint256_t_detail::to_limbs(mod, m);
+    uint256_t_detail::sub_mod(r, a, b, m);
+    return uint256_t_detail::from_limbs(r);
+}
+
+UINT256_T_DETAIL_BEGIN
+    // multiplication in Montgomery form for an odd modulus known at run time
+    struct montgomery_ops{
+        uint64_t m[4];
+        uint64_t ninv;
+
+        void mul(uint64_t r[4], const uint64_t a[4], const uint64_t b[4]) const{
+            uint256_t_detail::montgomery_mul(r, a, b, m, ninv);
+        }
+
+        void sqr(uint64_t r[4], const uint64_t a[4]) const{
+            uint256_t_detail::montgomery_sqr(r, a, m, ninv);
+        }
+    };
+
+    struct barrett_ops{
+        const barrett_context & ctx;
+
+        void mul(uint64_t r[4], const uint64_t a[4], const uint64_t b[4]) const{
+            to_limbs(ctx.mulmod(from_limbs(a), from_limbs(b)), r);
+        }
+
+        void sqr(uint64_t r[4], const uint64_t a[4]) const{
+            mul(r, a, a);
+        }
+    };
+
+    // r = base^exp, where one is the identity of ops; r must not alias base
+    // Left to right sliding window (HAC 14.85): runs of up to width bits that
+    // start and end with a 1 are looked up in a table of the odd powers of base
+    template <typename Ops>
+    UINT256_T_INLINE void window_pow(uint64_t r[4], const uint64_t base[4], const uint64_t one[4], const uint64_t exp[4], const Ops & ops){
+        int top = 3;
+        while ((top > 0) && !exp[top]){
+            top--;
+        }
+        if (!exp[top]){
+            std::memcpy(r, one, 4 * sizeof(uint64_t));
+            return;
+        }
+        const int bits = 64 * top + 64 - clz64(exp[top]);
+
+        // the table costs 2^(width - 1) multiplications, which pays off
+        // once there are enough windows to share it
+        unsigned int width = 1;
+        if (bits > 240){
+            width = 5;
+        }
+        else if (bits > 80){
+            width = 4;
+        }
+        else if (bits > 24){
+            width = 3;
+        }
+        else if (bits > 6){
+            width = 2;
+        }
+
+        // table[i] = base^(2i + 1)
+        uint64_t table[16][4];
+        std::memcpy(table[0], base, sizeof(table[0]));
+        if (width > 1){
+            uint64_t square[4];
+            ops.sqr(square, base);
+            for(unsigned int i = 1; i < (1u << (width - 1)); i++){
+                ops.mul(table[i], table[i - 1], square);
+            }
+        }
+
+        // the top bit is set, so r starts as the first window's table entry
+        int i = bits - 1;
+        bool first = true;
+        while (i >= 0){
+            if (!((exp[i / 64] >> (i % 64)) & 1)){
+                ops.sqr(r, r);
+                i--;
+                continue;
+            }
+
+            // the longest window of at most width bits that ends in a 1
+            int low = std::max(i - (int) width + 1, 0);
+            while (!((exp[low / 64] >> (low % 64)) & 1)){
+                low++;
+            }
+
+            unsigned int window = 0;
+            for(int j = i; j >= low; j--){
+                window = (window << 1) | ((exp[j / 64] >> (j % 64)) & 1);
+                if (!first){
+                    ops.sqr(r, r);
+                }
+            }
+            if (first){
+                std::memcpy(r, table[window >> 1], 4 * sizeof(uint64_t));
+                first = false;
+            }
+            else{
+                ops.mul(r, r, table[window >> 1]);
+            }
+            i = low - 1;
+        }
+    }
+UINT256_T_DETAIL_END
+
+UINT256_T_INLINE uint256_t powmod(const uint256_t & base, const uint256_t & exp, const uint256_t & mod){
+    if (!mod){
+        throw std::domain_error("Error: division or modulus by 0");
+    }
+
+    uint64_t e[4], r[4];
+    uint256_t_detail::to_limbs(exp, e);
+
+    if (!(mod & 1)){
+        const barrett_context ctx(mod);
+        const uint256_t_detail::barrett_ops ops = {ctx};
+        uint64_t b[4], one[4];
+        uint256_t_detail::to_limbs(ctx.reduce(base), b);
+        uint256_t_detail::to_limbs(ctx.reduce(uint256_1), one);
+        uint256_t_detail::window_pow(r, b, one, e, ops);
+        return uint256_t_detail::from_limbs(r);
+    }
+
+    uint256_t_detail::montgomery_ops ops;
+    uint256_t_detail::to_limbs(mod, ops.m);
+    ops.ninv = 0 - uint256_t_detail::inverse64(ops.m[0], ops.m[0], 5);
+
+    // 2^256 mod m, then 2^512 mod m by doubling it 8 times and squaring
+    // it 5 times in Montgomery form: R * 2^8 -> R * 2^16 -> ... -> R * 2^256
+    uint64_t one[4], r2[4];
+    uint256_t_detail::to_limbs((-mod) % mod, one);
+    std::memcpy(r2, one, sizeof(r2));
+    for(int i = 0; i < 8; i++){
+        uint256_t_detail::add_mod(r2, r2, r2, ops.m);
+    }
+    for(int i = 0; i < 5; i++){
+        ops.sqr(r2, r2);
+    }
+
+    uint64_t b[4];
+    uint256_t_detail::to_limbs(base, b);
+    ops.mul(b, b, r2);
+    uint256_t_detail::window_pow(r, b, one, e, ops);
+    uint256_t_detail::montgomery_redc(r, r, ops.m, ops.ninv);
+    return uint256_t_detail::from_limbs(r);
+}
+
+UINT256_T_DETAIL_BEGIN
+    // Modular inversion by safegcd divsteps
+    // Bernstein and Yang, "Fast constant-time gcd computation and modular
+    // inversion" (2019), in the variable time form used by libsecp256k1:
+    // batches of 62 divsteps are found from the lowest limbs of f and g
+    // alone, and then applied to the full values as a 2x2 matrix.
+
+    // values are 5 signed limbs of 62 bits, least significant first
+    // all but the top limb are kept in [0, 2^62)
+    const int64_t M62 = (int64_t) (((uint64_t) -1) >> 2);
+
+    struct signed62{
+        int64_t v[5];
+    };
+
+    // the divsteps scaled by 2^62: [u v; q r]
+    struct trans2x2{
+        int64_t u, v, q, r;
+    };
+
+    // signed 64 x 64 bit products summed into 128 bits
+    class acc128{
+        private:
+#if defined(__SIZEOF_INT128__)
+            __extension__ typedef __int128 dword;
+            dword value;
+#else
+            uint64_t lo;
+            int64_t hi;
+#endif
+
+        public:
+            acc128()
+#if defined(__SIZEOF_INT128__)
+                : value(0)
+#else
+                : lo(0), hi(0)
+#endif
+            {}
+
+            // += a * b
+            void mac(const int64_t a, const int64_t b){
+#if defined(__SIZEOF_INT128__)
+                value += (dword) a * b;
+#else
+                // the unsigned product, less 2^64 times each operand whose partner is negative
+                uint64_t p_hi;
+                const uint64_t p_lo = mul64((uint64_t) a, (uint64_t) b, p_hi);
+                p_hi -= ((a < 0)?(uint64_t) b:0) + ((b < 0)?(uint64_t) a:0);
+                lo += p_lo;
+                hi += (int64_t) (p_hi + (lo < p_lo));
+#endif
+            }
+
+            uint64_t low() const{
+#if defined(__SIZEOF_INT128__)
+                return (uint64_t) value;
+#else
+                return lo;
+#endif
+            }
+
+            // arithmetic shift right by 62; the result must fit in 64 bits
+            int64_t shr62(){
+#if defined(__SIZEOF_INT128__)
+                value >>= 62;
+                return (int64_t) value;
+#else
+                lo = (lo >> 62) | ((uint64_t) hi << 2);
+                hi >>= 62;
+                return (int64_t) lo;
+#endif
+            }
+    };
+
+    UINT256_T_INLINE void to_signed62(const uint64_t limbs[4], signed62 & out){
+        out.v[0] = (int64_t) (limbs[0] & M62);
+        out.v[1] = (int64_t) (((limbs[0] >> 62) | (limbs[1] << 2)) & M62);
+        out.v[2] = (int64_t) (((limbs[1] >> 60) | (limbs[2] << 4)) & M62);
+        out.v[3] = (int64_t) (((limbs[2] >> 58) | (limbs[3] << 6)) & M62);
+        out.v[4] = (int64_t) (limbs[3] >> 56);
+    }
+
+    // the value must be in [0, 2^256)
+    UINT256_T_INLINE void from_signed62(const signed62 & in, uint64_t limbs[4]){
+        limbs[0] = (uint64_t) in.v[0] | ((uint64_t) in.v[1] << 62);
+        limbs[1] = ((uint64_t) in.v[1] >> 2) | ((uint64_t) in.v[2] << 60);
+        limbs[2] = ((uint64_t) in.v[2] >> 4) | ((uint64_t) in.v[3] << 58);
+        limbs[3] = ((uint64_t) in.v[3] >> 6) | ((uint64_t) in.v[4] << 56);
+    }
+
+    // Up to 62 divsteps on the lowest 62 bits of f and g; returns the new eta (-delta)
+    // Runs of zeros at the bottom of g are skipped at once, and as many
+    // bits of g as eta allows are cancelled with a single multiple of f.
+    UINT256_T_INLINE int64_t divsteps_62(int64_t eta, uint64_t f, uint64_t g, trans2x2 & t){
+        uint64_t u = 1, v = 0, q = 0, r = 1;
+        int i = 62;
+        while (true){
+            const int zeros = ctz64(g | (((uint64_t) -1) << i));
+            g >>= zeros;
+            u <<= zeros;
+            v <<= zeros;
+            eta -= zeros;
+            i -= zeros;
+            if (!i){
+                break;
+            }
+
+            int limit;
+            uint64_t w;
+            if (eta < 0){
+                // swap f and g, negating the new g
+                uint64_t tmp;
+                eta = -eta;
+                tmp = f; f = g; g = 0 - tmp;
+                tmp = u; u = q; q = 0 - tmp;
+                tmp = v; v = r; r = 0 - tmp;
+
+                // cancel up to 6 bits of g: w = -g / f mod 2^limit
+                limit = ((int) eta + 1 > i)?i:((int) eta + 1);
+                const uint64_t m = (((uint64_t) -1) >> (64 - limit)) & 63;
+                w = (f * g * (f * f - 2)) & m;
+            }
+            else{
+                // cancel up to 4 bits of g
+                limit = ((int) eta + 1 > i)?i:((int) eta + 1);
+                const uint64_t m = (((uint64_t) -1) >> (64 - limit)) & 15;
+                w = f + (((f + 1) & 4) << 1);
+                w = (0 - w * g) & m;
+            }
+            g += f * w;
+            q += u * w;
+            r += v * w;
+        }
+        t.u = (int64_t) u;
+        t.v = (int64_t) v;
+        t.q = (int64_t) q;
+        t.r = (int64_t) r;
+        return eta;
+    }
+
+    // [d e] = [d e] * t / 2^62 mod m, for d and e in (-2m, m)
+    // A multiple of m is added to each so that the division is exact,
+    // which keeps them in (-2m, m).
+    UINT256_T_INLINE void update_de_62(signed62 & d, signed62 & e, const trans2x2 & t, const signed62 & m, const uint64_t m_inv62){
+        const int64_t u = t.u, v = t.v, q = t.q, r = t.r;
+        const int64_t sd = d.v[4] >> 63, se = e.v[4] >> 63;
+        int64_t md = (u & sd) + (v & se);
+        int64_t me = (q & sd) + (r & se);
+
+        acc128 cd, ce;
+        cd.mac(u, d.v[0]);
+        cd.mac(v, e.v[0]);
+        ce.mac(q, d.v[0]);
+        ce.mac(r, e.v[0]);
+
+        // the multiples of m that clear the lowest 62 bits
+        md -= (int64_t) ((m_inv62 * cd.low() + (uint64_t) md) & M62);
+        me -= (int64_t) ((m_inv62 * ce.low() + (uint64_t) me) & M62);
+        cd.mac(m.v[0], md);
+        ce.mac(m.v[0], me);
+        cd.shr62();
+        ce.shr62();
+
+        for(int i = 1; i < 5; i++){
+            cd.mac(u, d.v[i]);
+            cd.mac(v, e.v[i]);
+            cd.mac(m.v[i], md);
+            ce.mac(q, d.v[i]);
+            ce.mac(r, e.v[i]);
+            ce.mac(m.v[i], me);
+            d.v[i - 1] = (int64_t) (cd.low() & M62);
+            e.v[i - 1] = (int64_t) (ce.low() & M62);
+            cd.shr62();
+            ce.shr62();
+        }
+        d.v[4] = (int64_t) cd.low();
+        e.v[4] = (int64_t) ce.low();
+    }
+
+    // [f g] = [f g] * t / 2^62, using only the lowest len limbs
+    UINT256_T_INLINE void update_fg_62(const int len, signed62 & f, signed62 & g, const trans2x2 & t){
+        const int64_t u = t.u, v = t.v, q = t.q, r = t.r;
+        acc128 cf, cg;
+        cf.mac(u, f.v[0]);
+        cf.mac(v, g.v[0]);
+        cg.mac(q, f.v[0]);
+        cg.mac(r, g.v[0]);
+        // the lowest 62 bits are 0 by construction
+        cf.shr62();
+        cg.shr62();
+
+        for(int i = 1; i < len; i++){
+            cf.mac(u, f.v[i]);
+            cf.mac(v, g.v[i]);
+            cg.mac(q, f.v[i]);
+            cg.mac(r, g.v[i]);
+            f.v[i - 1] = (int64_t) (cf.low() & M62);
+            g.v[i - 1] = (int64_t) (cg.low() & M62);
+            cf.shr62();
+            cg.shr62();
+        }
+        f.v[len - 1] = (int64_t) cf.low();
+        g.v[len - 1] = (int64_t) cg.low();
+    }
+
+    // r in (-2m, m) -> r * sign(sign) mod m in [0, m)
+    UINT256_T_INLINE void normalize_62(signed62 & r, const int64_t sign, const signed62 & m){
+        int64_t r0 = r.v[0], r1 = r.v[1], r2 = r.v[2], r3 = r.v[3], r4 = r.v[4];
+
+        // add m if r is negative, then negate if sign is negative
+        int64_t add = r4 >> 63;
+        r0 += m.v[0] & add;
+        r1 += m.v[1] & add;
+        r2 += m.v[2] & add;
+        r3 += m.v[3] & add;
+        r4 += m.v[4] & add;
+        const int64_t negate = sign >> 63;
+        r0 = (r0 ^ negate) - negate;
+        r1 = (r1 ^ negate) - negate;
+        r2 = (r2 ^ negate) - negate;
+        r3 = (r3 ^ negate) - negate;
+        r4 = (r4 ^ negate) - negate;
+        r1 += r0 >> 62; r0 &= M62;
+        r2 += r1 >> 62; r1 &= M62;
+        r3 += r2 >> 62; r2 &= M62;
+        r4 += r3 >> 62; r3 &= M62;
+
+        // now in (-m, m); add m once more if negative
+        add = r4 >> 63;
+        r0 += m.v[0] & add;
+        r1 += m.v[1] & add;
+        r2 += m.v[2] & add;
+        r3 += m.v[3] & add;
+        r4 += m.v[4] & add;
+        r1 += r0 >> 62; r0 &= M62;
+        r2 += r1 >> 62; r1 &= M62;
+        r3 += r2 >> 62; r2 &= M62;
+        r4 += r3 >> 62; r3 &= M62;
+
+        r.v[0] = r0;
+        r.v[1] = r1;
+        r.v[2] = r2;
+        r.v[3] = r3;
+        r.v[4] = r4;
+    }
+UINT256_T_DETAIL_END
+
+UINT256_T_INLINE uint256_t invmod(const uint256_t & value, const uint256_t & mod){
+    if (!(mod & 1)){
+        throw std::invalid_argument("Error: modulus must be odd");
+    }
+    if (mod == uint256_1){
+        return uint256_0;
+    }
+
+    uint64_t limbs[4];
+    uint256_t_detail::signed62 m, f, g, d, e;
+    uint256_t_detail::to_limbs(mod, limbs);
+    uint256_t_detail::to_signed62(limbs, m);
+    const uint64_t m_inv62 = uint256_t_detail::inverse64(limbs[0], limbs[0], 5) & uint256_t_detail::M62;
+    uint256_t_detail::to_limbs((value < mod)?value:(value % mod), limbs);
+    uint256_t_detail::to_signed62(limbs, g);
+    f = m;
+    d.v[0] = d.v[1] = d.v[2] = d.v[3] = d.v[4] = 0;
+    e.v[0] = 1;
+    e.v[1] = e.v[2] = e.v[3] = e.v[4] = 0;
+
+    // f = m and g = value, and d and e track f and g as multiples of value mod m
+    int len = 5;
+    int64_t eta = -1;
+    while (true){
+        uint256_t_detail::trans2x2 t;
+        eta = uint256_t_detail::divsteps_62(eta, (uint64_t) f.v[0], (uint64_t) g.v[0], t);
+        uint256_t_detail::update_de_62(d, e, t, m, m_inv62);
+        uint256_t_detail::update_fg_62(len, f, g, t);
+
+        int64_t zero = g.v[0];
+        for(int i = 1; i < len; i++){
+            zero |= g.v[i];
+        }
+        if (!zero){
+            break;
+        }
+
+        // drop the top limb once both f and g fit in one fewer
+        const int64_t fn = f.v[len - 1], gn = g.v[len - 1];
+        if ((len > 1) && !((fn ^ (fn >> 63)) | (gn ^ (gn >> 63)))){
+            f.v[len - 2] |= (int64_t) ((uint64_t) fn << 62);
+            g.v[len - 2] |= (int64_t) ((uint64_t) gn << 62);
+            len--;
+        }
+    }
+
+    // f is now +-gcd(value, mod)
+    // +1 has limbs 1, 0, ... 0 and -1 has limbs 2^62 - 1, ... 2^62 - 1, -1
+    const bool negative = f.v[len - 1] < 0;
+    bool one = (f.v[0] == (negative?((len > 1)?uint256_t_detail::M62:-1):1));
+    for(int i = 1; i < len; i++){
+        one &= (f.v[i] == (negative?((i < len - 1)?uint256_t_detail::M62:-1):0));
+    }
+    if (!one){
+        throw std::domain_error("Error: value has no inverse modulo mod");
+    }
+
+    uint256_t_detail::normalize_62(d, f.v[len - 1], m);
+    uint256_t_detail::from_signed62(d, limbs);
+    return uint256_t_detail::from_limbs(limbs);
+}
+
+UINT256_T_DETAIL_BEGIN
+    // number of trailing zero bits of a nonzero N limb value
+    template <unsigned int N>
+    UINT256_T_INLINE unsigned int ctz_limbs(const uint64_t x[N]){
+        unsigned int i = 0;
+        while (!x[i]){
+            i++;
+        }
+        return 64 * i + ctz64(x[i]);
+    }
+
+    // x >>= shift, for shift < 64 * N
+    template <unsigned int N>
+    UINT256_T_INLINE void shr_limbs(uint64_t x[N], const unsigned int shift){
+        const unsigned int words = shift / 64, bits = shift % 64;
+        for(unsigned int i = 0; i < N; i++){
+            const uint64_t lo = (i + words < N)?x[i + words]:0;
+            const uint64_t hi = (i + words + 1 < N)?x[i + words + 1]:0;
+            // (hi << 1) << (63 - bits) is hi << (64 - bits), and 0 when bits == 0
+            x[i] = (lo >> bits) | ((hi << 1) << (63 - bits));
+        }
+    }
+
+    // Stein's binary gcd of odd a and nonzero b; the result is left in a
+    template <unsigned int N>
+    void odd_gcd(uint64_t a[N], uint64_t b[N]);
+
+    template <>
+    UINT256_T_INLINE void odd_gcd<1>(uint64_t a[1], uint64_t b[1]){
+        uint64_t x = a[0], y = b[0];
+        while (y){
+            y >>= ctz64(y);
+            if (x > y){
+                std::swap(x, y);
+            }
+            y -= x;
+        }
+        a[0] = x;
+    }
+
+    template <unsigned int N>
+    UINT256_T_INLINE void odd_gcd(uint64_t a[N], uint64_t b[N]){
+        while (true){
+            shr_limbs<N>(b, ctz_limbs<N>(b));
+
+            // b -= a, swapping first if b < a; b is then even
+            uint64_t d[N], e[N];
+            uint64_t borrow = 0, zero = 0;
+            for(unsigned int i = 0; i < N; i++){
+                d[i] = subb64(b[i], a[i], borrow);
+                zero |= d[i];
+            }
+            if (borrow){
+                uint64_t swapped = 0;
+                for(unsigned int i = 0; i < N; i++){
+                    e[i] = subb64(a[i], b[i], swapped);
+                    a[i] = b[i];
+                    b[i] = e[i];
+                }
+            }
+            else if (!zero){
+                return;
+            }
+            else{
+                std::copy(d, d + N, b);
+            }
+
+            // continue in half the limbs once both fit
+            uint64_t upper = 0;
+            for(unsigned int i = N / 2; i < N; i++){
+                upper |= a[i] | b[i];
+            }
+            if (!upper){
+                odd_gcd<N / 2>(a, b);
+                return;
+            }
+        }
+    }
+UINT256_T_DETAIL_END
+
+UINT256_T_INLINE uint256_t gcd(const uint256_t & lhs, const uint256_t & rhs){
+    const bool lhs_smaller = lhs < rhs;
+    const uint256_t & small = lhs_smaller?lhs:rhs;
+    uint256_t large = lhs_smaller?rhs:lhs;
+    if (!small){
+        return large;
+    }
+
+    // when the smaller operand fits in 64 or 128 bits, one division brings
+    // the larger down to the same width
+    unsigned int n = 4;
+    if (!small.upper()){
+        n = small.lower().upper()?2:1;
+        if (large.upper() || ((n == 1) && large.lower().upper())){
+            large %= small;
+            if (!large){
+                return small;
+            }
+        }
+    }
+
+    uint64_t a[4], b[4];
+    uint256_t_detail::to_limbs(small, a);
+    uint256_t_detail::to_limbs(large, b);
+    const unsigned int za = uint256_t_detail::ctz_limbs<4>(a), zb = uint256_t_detail::ctz_limbs<4>(b);
+    uint256_t_detail::shr_limbs<4>(a, za);
+    switch (n){
+        case 1:
+            uint256_t_detail::odd_gcd<1>(a, b);
+            break;
+        case 2:
+            uint256_t_detail::odd_gcd<2>(a, b);
+            break;
+        default:
+            uint256_t_detail::odd_gcd<4>(a, b);
+            break;
+    }
+    return uint256_t_detail::from_limbs(a) << std::min(za, zb);
+}
+
+UINT256_T_INLINE uint256_t lcm(const uint256_t & lhs, const uint256_t & rhs){
+    if (!lhs || !rhs){
+        return uint256_0;
+    }
+    return (lhs / gcd(lhs, rhs)) * rhs;
+}
+
+UINT256_T_DETAIL_BEGIN
+    // Hides a value from the optimizer so that masks made from it are not
+    // turned back into branches
+    UINT256_T_INLINE uint64_t ct_barrier(uint64_t x){
+#if defined(__GNUC__) || defined(__clang__)
+        __asm__("" : "+r"(x));
+        return x;
+#else
+        volatile uint64_t v = x;
+        return v;
+#endif
+    }
+
+    // all ones if x is 0, otherwise 0
+    UINT256_T_INLINE uint64_t ct_zero_mask(const uint64_t x){
+        return ct_barrier(((x | (0 - x)) >> 63) - 1);
+    }
+
+    UINT256_T_INLINE void ct_select_limbs(uint64_t r[4], const uint64_t mask, const uint64_t a[4], const uint64_t b[4]){
+        for(int i = 0; i < 4; i++){
+            r[i] = b[i] ^ (mask & (a[i] ^ b[i]));
+        }
+    }
+
+    // one stage of a barrel shifter: x <<= (1 << stage) if bit is set
+    // The stage is public, so only the choice of result depends on the secret.
+    UINT256_T_INLINE void ct_shl_stage(uint64_t x[4], const unsigned int stage, const uint64_t bit){
+        const unsigned int words = (1U << stage) / 64, bits = (1U << stage) % 64;
+        uint64_t shifted[4];
+        for(int i = 3; i >= 0; i--){
+            const uint64_t hi = (i >= (int) words)?x[i - words]:0;
+            const uint64_t lo = (i >= (int) words + 1)?x[i - words - 1]:0;
+            shifted[i] = (hi << bits) | ((lo >> 1) >> (63 - bits));
+        }
+        ct_select_limbs(x, ct_barrier(0 - bit), shifted, x);
+    }
+
+    UINT256_T_INLINE void ct_shr_stage(uint64_t x[4], const unsigned int stage, const uint64_t bit){
+        const unsigned int words = (1U << stage) / 64, bits = (1U << stage) % 64;
+        uint64_t shifted[4];
+        for(unsigned int i = 0; i < 4; i++){
+            const uint64_t lo = (i + words < 4)?x[i + words]:0;
+            const uint64_t hi = (i + words + 1 < 4)?x[i + words + 1]:0;
+            shifted[i] = (lo >> bits) | ((hi << 1) << (63 - bits));
+        }
+        ct_select_limbs(x, ct_barrier(0 - bit), shifted, x);
+    }
+UINT256_T_DETAIL_END
+
+UINT256_T_INLINE uint64_t ct_eq(const uint256_t & lhs, const uint256_t & rhs){
+    uint64_t a[4], b[4];
+    uint256_t_detail::to_limbs(lhs, a);
+    uint256_t_detail::to_limbs(rhs, b);
+    return uint256_t_detail::ct_zero_mask((a[0] ^ b[0]) | (a[1] ^ b[1]) | (a[2] ^ b[2]) | (a[3] ^ b[3]));
+}
+
+UINT256_T_INLINE uint64_t ct_lt(const uint256_t & lhs, const uint256_t & rhs){
+    uint64_t a[4], b[4];
+    uint256_t_detail::to_limbs(lhs, a);
+    uint256_t_detail::to_limbs(rhs, b);
+    uint64_t borrow = 0;
+    for(int i = 0; i < 4; i++){
+        uint256_t_detail::subb64(a[i], b[i], borrow);
+    }
+    return uint256_t_detail::ct_barrier(0 - borrow);
+}
+
+UINT256_T_INLINE uint256_t ct_select(const uint64_t mask, const uint256_t & lhs, const uint256_t & rhs){
+    uint64_t a[4], b[4], r[4];
+    uint256_t_detail::to_limbs(lhs, a);
+    uint256_t_detail::to_limbs(rhs, b);
+    uint256_t_detail::ct_select_limbs(r, uint256_t_detail::ct_barrier(mask), a, b);
+    return uint256_t_detail::from_limbs(r);
+}
+
+UINT256_T_INLINE void ct_swap(const uint64_t mask, uint256_t & lhs, uint256_t & rhs){
+    uint64_t a[4], b[4];
+    uint256_t_detail::to_limbs(lhs, a);
+    uint256_t_detail::to_limbs(rhs, b);
+    const uint64_t m = uint256_t_detail::ct_barrier(mask);
+    for(int i = 0; i < 4; i++){
+        const uint64_t t = m & (a[i] ^ b[i]);
+        a[i] ^= t;
+        b[i] ^= t;
+    }
+    lhs = uint256_t_detail::from_limbs(a);
+    rhs = uint256_t_detail::from_limbs(b);
+}
+
+UINT256_T_INLINE uint256_t ct_shl(const uint256_t & value, const uint64_t shift){
+    uint64_t x[4];
+    uint256_t_detail::to_limbs(value, x);
+    for(unsigned int stage = 0; stage < 8; stage++){
+        uint256_t_detail::ct_shl_stage(x, stage, (shift >> stage) & 1);
+    }
+    const uint64_t zero[4] = {0, 0, 0, 0};
+    uint256_t_detail::ct_select_limbs(x, uint256_t_detail::ct_zero_mask(shift >> 8), x, zero);
+    return uint256_t_detail::from_limbs(x);
+}
+
+UINT256_T_INLINE uint256_t ct_shr(const uint256_t & value, const uint64_t shift){
+    uint64_t x[4];
+    uint256_t_detail::to_limbs(value, x);
+    for(unsigned int stage = 0; stage < 8; stage++){
+        uint256_t_detail::ct_shr_stage(x, stage, (shift >> stage) & 1);
+    }
+    const uint64_t zero[4] = {0, 0, 0, 0};
+    uint256_t_detail::ct_select_limbs(x, uint256_t_detail::ct_zero_mask(shift >> 8), x, zero);
+    return uint256_t_detail::from_limbs(x);
+}
+
+UINT256_T_INLINE uint256_t ct_mulmod(const uint256_t & lhs, const uint256_t & rhs, const uint256_t & mod){
+    if (!mod){
+        throw std::domain_error("Error: division or modulus by 0");
+    }
 
-uint256_t operator<<(const uint128_t & lhs, const uint256_t & rhs){
+    uint64_t a[4], b[4], m[4], t[8];
+    uint256_t_detail::to_limbs(lhs, a);
+    uint256_t_detail::to_limbs(rhs, b);
+    uint256_t_detail::to_limbs(mod, m);
+    uint256_t_detail::mul_limbs_wide(a, b, t);
+
+    // r = 2r + bit mod m for each bit of the product, from the top
+    // r < m, so 2r + 1 < 2m and one conditional subtraction is enough
+    uint64_t r0 = 0, r1 = 0, r2 = 0, r3 = 0;
+    for(int i = 511; i >= 0; i--){
+        const uint64_t top = r3 >> 63;
+        r3 = (r3 << 1) | (r2 >> 63);
+        r2 = (r2 << 1) | (r1 >> 63);
+        r1 = (r1 << 1) | (r0 >> 63);
+        r0 = (r0 << 1) | ((t[i / 64] >> (i % 64)) & 1);
+
+        uint64_t borrow = 0;
+        const uint64_t d0 = uint256_t_detail::subb64(r0, m[0], borrow);
+        const uint64_t d1 = uint256_t_detail::subb64(r1, m[1], borrow);
+        const uint64_t d2 = uint256_t_detail::subb64(r2, m[2], borrow);
+        const uint64_t d3 = uint256_t_detail::subb64(r3, m[3], borrow);
+
+        // keep the difference unless it went negative past the top bit
+        const uint64_t keep = uint256_t_detail::ct_barrier(0 - (top | (borrow ^ 1)));
+        r0 ^= keep & (d0 ^ r0);
+        r1 ^= keep & (d1 ^ r1);
+        r2 ^= keep & (d2 ^ r2);
+        r3 ^= keep & (d3 ^ r3);
+    }
+    const uint64_t r[4] = {r0, r1, r2, r3};
+    return uint256_t_detail::from_limbs(r);
+}
+
+UINT256_T_INLINE uint256_t operator&(const uint128_t & lhs, const uint256_t & rhs){
+    return rhs & lhs;
+}
+
+UINT256_T_INLINE uint128_t & operator&=(uint128_t & lhs, const uint256_t & rhs){
+    lhs = (rhs & lhs).lower();
+    return lhs;
+}
+
+UINT256_T_INLINE uint256_t operator|(const uint128_t & lhs, const uint256_t & rhs){
+    return rhs | lhs;
+}
+
+UINT256_T_INLINE uint128_t & operator|=(uint128_t & lhs, const uint256_t & rhs){
+    lhs = (rhs | lhs).lower();
+    return lhs;
+}
+
+UINT256_T_INLINE uint256_t operator^(const uint128_t & lhs, const uint256_t & rhs){
+    return rhs ^ lhs;
+}
+
+UINT256_T_INLINE uint128_t & operator^=(uint128_t & lhs, const uint256_t & rhs){
+    lhs = (rhs ^ lhs).lower();
+    return lhs;
+}
+
+UINT256_T_INLINE uint256_t operator<<(const bool & lhs, const uint256_t & rhs){
     return uint256_t(lhs) << rhs;
 }
 
-uint256_t operator<<(const int8_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint256_t operator<<(const uint8_t & lhs, const uint256_t & rhs){
     return uint256_t(lhs) << rhs;
 }
 
-uint256_t operator<<(const int16_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint256_t operator<<(const uint16_t & lhs, const uint256_t & rhs){
     return uint256_t(lhs) << rhs;
 }
 
-uint256_t operator<<(const int32_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint256_t operator<<(const uint32_t & lhs, const uint256_t & rhs){
     return uint256_t(lhs) << rhs;
 }
 
-uint256_t operator<<(const int64_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint256_t operator<<(const uint64_t & lhs, const uint256_t & rhs){
     return uint256_t(lhs) << rhs;
 }
 
-uint128_t & operator<<=(uint128_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint256_t operator<<(const uint128_t & lhs, const uint256_t & rhs){
+    return uint256_t(lhs) << rhs;
+}
+
+UINT256_T_INLINE uint256_t operator<<(const int8_t & lhs, const uint256_t & rhs){
+    return uint256_t(lhs) << rhs;
+}
+
+UINT256_T_INLINE uint256_t operator<<(const int16_t & lhs, const uint256_t & rhs){
+    return uint256_t(lhs) << rhs;
+}
+
+UINT256_T_INLINE uint256_t operator<<(const int32_t & lhs, const uint256_t & rhs){
+    return uint256_t(lhs) << rhs;
+}
+
+UINT256_T_INLINE uint256_t operator<<(const int64_t & lhs, const uint256_t & rhs){
+    return uint256_t(lhs) << rhs;
+}
+
+UINT256_T_INLINE uint128_t & operator<<=(uint128_t & lhs, const uint256_t & rhs){
     lhs = (uint256_t(lhs) << rhs).lower();
     return lhs;
 }
 
-uint256_t operator>>(const bool & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint256_t operator>>(const bool & lhs, const uint256_t & rhs){
     return uint256_t(lhs) >> rhs;
 }
 
-uint256_t operator>>(const uint8_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint256_t operator>>(const uint8_t & lhs, const uint256_t & rhs){
     return uint256_t(lhs) >> rhs;
 }
 
-uint256_t operator>>(const uint16_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint256_t operator>>(const uint16_t & lhs, const uint256_t & rhs){
     return uint256_t(lhs) >> rhs;
 }
 
-uint256_t operator>>(const uint32_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint256_t operator>>(const uint32_t & lhs, const uint256_t & rhs){
     return uint256_t(lhs) >> rhs;
 }
 
-uint256_t operator>>(const uint64_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint256_t operator>>(const uint64_t & lhs, const uint256_t & rhs){
     return uint256_t(lhs) >> rhs;
 }
 
-uint256_t operator>>(const uint128_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint256_t operator>>(const uint128_t & lhs, const uint256_t & rhs){
     return uint256_t(lhs) >> rhs;
 }
 
-uint256_t operator>>(const int8_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint256_t operator>>(const int8_t & lhs, const uint256_t & rhs){
     return uint256_t(lhs) >> rhs;
 }
 
-uint256_t operator>>(const int16_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint256_t operator>>(const int16_t & lhs, const uint256_t & rhs){
     return uint256_t(lhs) >> rhs;
 }
 
-uint256_t operator>>(const int32_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint256_t operator>>(const int32_t & lhs, const uint256_t & rhs){
     return uint256_t(lhs) >> rhs;
 }
 
-uint256_t operator>>(const int64_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint256_t operator>>(const int64_t & lhs, const uint256_t & rhs){
     return uint256_t(lhs) >> rhs;
 }
 
-uint128_t & operator>>=(uint128_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint128_t & operator>>=(uint128_t & lhs, const uint256_t & rhs){
     lhs = (uint256_t(lhs) >> rhs).lower();
     return lhs;
 }
 
 // Comparison Operators
-bool operator==(const uint128_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE bool operator==(const uint128_t & lhs, const uint256_t & rhs){
     return rhs == lhs;
 }
 
-bool operator!=(const uint128_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE bool operator!=(const uint128_t & lhs, const uint256_t & rhs){
     return rhs != lhs;
 }
 
-bool operator>(const uint128_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE bool operator>(const uint128_t & lhs, const uint256_t & rhs){
     return rhs < lhs;
 }
 
-bool operator<(const uint128_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE bool operator<(const uint128_t & lhs, const uint256_t & rhs){
     return rhs > lhs;
 }
 
-bool operator>=(const uint128_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE bool operator>=(const uint128_t & lhs, const uint256_t & rhs){
     return rhs <= lhs;
 }
 
-bool operator<=(const uint128_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE bool operator<=(const uint128_t & lhs, const uint256_t & rhs){
     return rhs >= lhs;
 }
 
 // Arithmetic Operators
-uint256_t operator+(const uint128_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint256_t operator+(const uint128_t & lhs, const uint256_t & rhs){
     return rhs + lhs;
 }
 
-uint128_t & operator+=(uint128_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint128_t & operator+=(uint128_t & lhs, const uint256_t & rhs){
     lhs = (rhs + lhs).lower();
     return lhs;
 }
 
-uint256_t operator-(const uint128_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint256_t operator-(const uint128_t & lhs, const uint256_t & rhs){
     return -(rhs - lhs);
 }
 
-uint128_t & operator-=(uint128_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint128_t & operator-=(uint128_t & lhs, const uint256_t & rhs){
     lhs = (-(rhs - lhs)).lower();
     return lhs;
 }
 
-uint256_t operator*(const uint128_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint256_t operator*(const uint128_t & lhs, const uint256_t & rhs){
     return rhs * lhs;
 }
 
-uint128_t & operator*=(uint128_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint128_t & operator*=(uint128_t & lhs, const uint256_t & rhs){
     lhs = (rhs * lhs).lower();
     return lhs;
 }
 
-uint256_t operator/(const uint128_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint256_t operator/(const uint128_t & lhs, const uint256_t & rhs){
     return uint256_t(lhs) / rhs;
 }
 
-uint128_t & operator/=(uint128_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint128_t & operator/=(uint128_t & lhs, const uint256_t & rhs){
     lhs = (uint256_t(lhs) / rhs).lower();
     return lhs;
 }
 
-uint256_t operator%(const uint128_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint256_t operator%(const uint128_t & lhs, const uint256_t & rhs){
     return uint256_t(lhs) % rhs;
 }
 
-uint128_t & operator%=(uint128_t & lhs, const uint256_t & rhs){
+UINT256_T_INLINE uint128_t & operator%=(uint128_t & lhs, const uint256_t & rhs){
     lhs = (uint256_t(lhs) % rhs).lower();
     return lhs;
 }
 
-std::ostream & operator<<(std::ostream & stream, const uint256_t & rhs){
+UINT256_T_INLINE std::ostream & operator<<(std::ostream & stream, const uint256_t & rhs){
     if (stream.flags() & stream.oct){
         stream << rhs.str(8);
     }
@@ -729,7 +3523,289 @@ std::ostream & operator<<(std::ostream & stream, const uint256_t & rhs){
         stream << rhs.str(10);
     }
     else if (stream.flags() & stream.hex){
-        stream << rhs.str(16);
+        stream << rhs.str(16, 0, (bool) (stream.flags() & stream.uppercase));
     }
     return stream;
 }
+
+UINT256_T_INLINE uint256_to_chars_result to_chars(char * first, char * last, const uint256_t & value, int base){
+    uint256_to_chars_result result;
+    if ((base < 2) || (base > 36)){
+        result.ptr = first;
+        result.ec = std::errc::invalid_argument;
+        return result;
+    }
+
+    char buf[256];
+    char * const end = buf + sizeof(buf);
+    uint64_t limbs[4];
+    uint256_t_detail::to_limbs(value, limbs);
+    const char * p = uint256_t_detail::format_limbs(end, limbs, base, uint256_t_detail::lower_digits);
+
+    const std::size_t size = end - p;
+    if ((std::size_t) (last - first) < size){
+        result.ptr = last;
+        result.ec = std::errc::value_too_large;
+        return result;
+    }
+
+    std::memcpy(first, p, size);
+    result.ptr = first + size;
+    result.ec = std::errc();
+    return result;
+}
+
+UINT256_T_INLINE uint256_from_chars_result from_chars(const char * first, const char * last, uint256_t & value, int base){
+    uint256_from_chars_result result;
+    if ((base < 2) || (base > 36)){
+        result.ptr = first;
+        result.ec = std::errc::invalid_argument;
+        return result;
+    }
+
+    uint64_t limbs[4];
+    bool overflow;
+    result.ptr = uint256_t_detail::parse_limbs(first, last, base, limbs, overflow);
+    if (result.ptr == first){
+        result.ec = std::errc::invalid_argument;
+    }
+    else if (overflow){
+        result.ec = std::errc::result_out_of_range;
+    }
+    else{
+        value = uint256_t_detail::from_limbs(limbs);
+        result.ec = std::errc();
+    }
+    return result;
+}
+
+UINT256_T_DETAIL_BEGIN
+    // read only view of a whole file
+    class mapped_file{
+        private:
+            const char * data_;
+            std::size_t size_;
+#ifdef UINT256_T_HAS_MMAP
+            void * map;
+#else
+            std::vector <char> buf;
+#endif
+
+        public:
+            mapped_file(const std::string & path)
+                : data_(nullptr), size_(0)
+#ifdef UINT256_T_HAS_MMAP
+                , map(MAP_FAILED)
+#endif
+            {
+#ifdef UINT256_T_HAS_MMAP
+                const int fd = open(path.c_str(), O_RDONLY);
+                if (fd < 0){
+                    throw std::runtime_error("Error: could not open " + path);
+                }
+                struct stat st;
+                if (fstat(fd, &st) < 0){
+                    close(fd);
+                    throw std::runtime_error("Error: could not stat " + path);
+                }
+                size_ = st.st_size;
+                if (size_){
+                    map = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+                    if (map == MAP_FAILED){
+                        close(fd);
+                        throw std::runtime_error("Error: could not map " + path);
+                    }
+                    madvise(map, size_, MADV_SEQUENTIAL);
+                    data_ = (const char *) map;
+                }
+                close(fd);
+#else
+                std::ifstream file(path.c_str(), std::ios::binary);
+                if (!file){
+                    throw std::runtime_error("Error: could not open " + path);
+                }
+                buf.assign(std::istreambuf_iterator <char> (file), std::istreambuf_iterator <char> ());
+                data_ = buf.data();
+                size_ = buf.size();
+#endif
+            }
+
+            ~mapped_file(){
+#ifdef UINT256_T_HAS_MMAP
+                if (map != MAP_FAILED){
+                    munmap(map, size_);
+                }
+#endif
+            }
+
+            mapped_file(const mapped_file &) = delete;
+            mapped_file & operator=(const mapped_file &) = delete;
+
+            const char * data() const{
+                return data_;
+            }
+
+            std::size_t size() const{
+                return size_;
+            }
+    };
+
+    // a line aligned piece of a file
+    struct line_range{
+        const char * first;
+        const char * last;
+        std::size_t lines;                  // number of lines in the range
+        std::size_t line;                   // index of the first line in the file
+        std::vector <std::size_t> malformed;
+        std::exception_ptr error;           // thrown by the worker, rethrown after joining
+    };
+
+    UINT256_T_INLINE std::size_t count_lines(const char * first, const char * last){
+        std::size_t lines = 0;
+        while (first != last){
+            const char * newline = (const char *) std::memchr(first, '\n', last - first);
+            lines++;
+            first = newline?(newline + 1):last;
+        }
+        return lines;
+    }
+
+    UINT256_T_INLINE void count_range(line_range & range){
+        try{
+            range.lines = count_lines(range.first, range.last);
+        }
+        catch (...){
+            range.error = std::current_exception();
+        }
+    }
+
+    UINT256_T_INLINE void parse_range(line_range & range, const uint8_t base, uint256_t * values){
+        std::size_t line = range.line;
+        const char * first = range.first;
+        while (first != range.last){
+            const char * newline = (const char *) std::memchr(first, '\n', range.last - first);
+            const char * last = newline?newline:range.last;
+            if ((last != first) && (last[-1] == '\r')){
+                last--;
+            }
+
+            uint64_t limbs[4];
+            if (parse_number(first, last, base, limbs) != PARSE_OK){
+                values[line] = uint256_0;
+                range.malformed.push_back(line + 1);
+            }
+            else{
+                values[line] = from_limbs(limbs);
+            }
+
+            line++;
+            first = newline?(newline + 1):range.last;
+        }
+    }
+
+    UINT256_T_INLINE void parse_lines(line_range & range, const uint8_t base, uint256_t * values){
+        try{
+            parse_range(range, base, values);
+        }
+        catch (...){
+            range.error = std::current_exception();
+        }
+    }
+
+    // a worker that throws would call std::terminate, so each one keeps
+    // its exception for the caller to see once every thread has joined
+    UINT256_T_INLINE void rethrow_errors(const std::vector <line_range> & ranges){
+        for(const line_range & range : ranges){
+            if (range.error){
+                std::rethrow_exception(range.error);
+            }
+        }
+    }
+
+    // the worker threads of one phase; they are joined even when starting
+    // one of them throws, since destroying a joinable std::thread terminates
+    struct worker_group{
+        std::vector <std::thread> threads;
+
+        ~worker_group(){
+            join();
+        }
+
+        void join(){
+            for(std::thread & thread : threads){
+                if (thread.joinable()){
+                    thread.join();
+                }
+            }
+            threads.clear();
+        }
+    };
+UINT256_T_DETAIL_END
+
+UINT256_T_INLINE uint256_load_result load_uint256_file(const std::string & path, uint8_t base, unsigned int threads){
+    if ((base < 2) || (base > 36)){
+        throw std::invalid_argument("Base must be in the range 2-36");
+    }
+
+    const uint256_t_detail::mapped_file file(path);
+    if (!file.size()){
+        return uint256_load_result();
+    }
+    const char * const begin = file.data();
+    const char * const end = begin + file.size();
+
+    // don't bother splitting small files across every core
+    if (!threads){
+        const std::size_t min_range = 1 << 16;
+        threads = std::max(1u, std::thread::hardware_concurrency());
+        threads = (unsigned int) std::min <std::size_t> (threads, file.size() / min_range + 1);
+    }
+
+    // split the file at the first newline after each even split point
+    std::vector <uint256_t_detail::line_range> ranges(threads);
+    const char * first = begin;
+    for(unsigned int i = 0; i < threads; i++){
+        const char * last = end;
+        if (i + 1 < threads){
+            last = std::max(first, begin + (file.size() / threads) * (i + 1));
+            const char * newline = (const char *) std::memchr(last, '\n', end - last);
+            last = newline?(newline + 1):end;
+        }
+        ranges[i].first = first;
+        ranges[i].last = last;
+        first = last;
+    }
+
+    // count the lines in each range so that every value has a slot before parsing starts
+    uint256_t_detail::worker_group workers;
+    workers.threads.reserve(threads - 1);
+    for(unsigned int i = 1; i < threads; i++){
+        workers.threads.emplace_back(uint256_t_detail::count_range, std::ref(ranges[i]));
+    }
+    uint256_t_detail::count_range(ranges[0]);
+    workers.join();
+    uint256_t_detail::rethrow_errors(ranges);
+
+    std::size_t lines = 0;
+    for(uint256_t_detail::line_range & range : ranges){
+        range.line = lines;
+        lines += range.lines;
+    }
+
+    uint256_load_result result;
+    result.values.resize(lines);
+    uint256_t * values = result.values.data();
+    for(unsigned int i = 1; i < threads; i++){
+        workers.threads.emplace_back(uint256_t_detail::parse_lines, std::ref(ranges[i]), base, values);
+    }
+    uint256_t_detail::parse_lines(ranges[0], base, values);
+    workers.join();
+    uint256_t_detail::rethrow_errors(ranges);
+
+    for(const uint256_t_detail::line_range & range : ranges){
+        result.malformed.insert(result.malformed.end(), range.malformed.begin(), range.malformed.end());
+    }
+    return result;
+}
+
+#endif
@@ -2,7 +2,14 @@
 #ifndef _UINT256_H_
 #define _UINT256_H_
 #include "uint256_t_config.include"
+#ifdef UINT256_T_HEADER_ONLY
+#define UINT256_T_EXTERN
+#else
 #define UINT256_T_EXTERN _UINT256_T_IMPORT
+#endif
 #include "uint128_t.h"
 #include "uint256_t.include"
+#ifdef UINT256_T_HEADER_ONLY
+#include "uint256_t.cpp"
+#endif
 #endif